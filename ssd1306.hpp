@@ -1,4 +1,9 @@
 #pragma once
 
 #include "ssd1306_display.hpp"
-#include "ssd1306_charts.hpp"
\ No newline at end of file
+#include "ssd1306_charts.hpp"
+#include "ssd1306_widgets.hpp"
+#include "ssd1306_assets.hpp"
+#include "ssd1306_sprites.hpp"
+#include "ssd1306_tiles.hpp"
+#include "ssd1306_gray.hpp"
@@ -0,0 +1,391 @@
+#include "ssd1306_assets.hpp"
+
+
+/**
+ * @brief Reads little-endian numbers of the pack index and headers
+ */
+static inline uint16_t get_le16(const uint8_t* p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+static inline uint32_t get_le32(const uint8_t* p)
+{
+  return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+
+
+
+/**
+ * @brief Construct a new Asset Pack. Call "open" before use
+ *
+ * @param read_func                   pack read function (SPI flash driver, "memcpy" from mmap'ed file, ...)
+ * @param read_ctx                    context of the read function
+ * @param cache_buf                   cache buffer, cache_slots_num * cache_slot_sz bytes
+ * @param cache_slots                 cache slots descriptors, cache_slots_num size
+ * @param cache_slots_num             amount of cache slots (1 .. 255)
+ * @param cache_slot_sz               size of one slot (bytes), multiple of 4. Determines max glyph and bitmap tile size
+ */
+AssetPack::AssetPack(AssetReadFunc read_func, void* read_ctx, uint32_t* cache_buf, AssetCacheSlot* cache_slots, uint8_t cache_slots_num, uint16_t cache_slot_sz) :
+read(read_func), ctx(read_ctx), cache((uint8_t*)cache_buf), slots(cache_slots), slots_num(cache_slots_num), slot_sz(cache_slot_sz & ~3),
+entries_num(0), stamp(0), hits(0), misses(0)
+{
+  flush_cache();
+}
+
+
+
+
+/**
+ * @brief Checks the pack header and reads amount of the assets
+ *
+ * @return                            "true" if the pack is valid
+ */
+bool AssetPack::open()
+{
+  uint8_t header[ASSET_PACK_HEADER_SZ];
+
+  entries_num = 0;
+  flush_cache();
+
+  if(!read_bytes(0, header, sizeof(header)) || get_le32(header) != ASSET_PACK_MAGIC)
+    return false;
+
+  entries_num = get_le16(header + 4);
+  return true;
+}
+
+
+
+
+/**
+ * @brief Finds the asset by binary search in the pack index
+ *
+ * @param type                        asset type ASSET_TYPE:: [FONT, BITMAP, STRINGS]
+ * @param id                          asset id (see "#define ASSET_..." written by "ssd1306_assetc pack")
+ * @param entry                       found asset position
+ * @return                            "true" if the asset is found
+ */
+bool AssetPack::find(ASSET_TYPE type, uint16_t id, AssetEntry* entry)
+{
+  uint8_t e[ASSET_ENTRY_SZ];
+  uint32_t key = ((uint32_t)type << 16) | id;
+  uint16_t lo = 0, hi = entries_num;
+
+  while(lo < hi)
+  {
+    uint16_t mid = (lo + hi) >> 1;
+
+    if(!read_bytes(ASSET_PACK_HEADER_SZ + (uint32_t)mid*ASSET_ENTRY_SZ, e, sizeof(e)))
+      return false;
+
+    uint32_t mid_key = ((uint32_t)e[0] << 16) | get_le16(e + 2);
+
+    if(mid_key == key)
+    {
+      entry->offset = get_le32(e + 4);
+      entry->size = get_le32(e + 8);
+      return true;
+    }
+
+    if(mid_key < key)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return false;
+}
+
+
+
+
+/**
+ * @brief Reads pack bytes directly, without cache
+ */
+bool AssetPack::read_bytes(uint32_t offset, void* dst, uint16_t len)
+{
+  return read != (AssetReadFunc)0 && read(ctx, offset, dst, len);
+}
+
+
+
+
+/**
+ * @brief Returns pack item from the cache. If it is not cached, the least recently used slot is replaced by it.
+ *        Returned data stays valid until the next "fetch" call
+ *
+ * @param offset                      item offset in the pack, it identifies the item
+ * @param len                         item size (bytes), not more than slot size
+ * @return                            pointer to the item data (4 bytes aligned) or null if the item can not be read
+ */
+const uint8_t* AssetPack::fetch(uint32_t offset, uint16_t len)
+{
+  uint8_t lru = 0;
+
+  if(len > slot_sz || slots_num == 0)
+    return (const uint8_t*)0;
+
+  stamp++;
+
+  for(uint8_t i = 0; i < slots_num; i++)
+  {
+    if(slots[i].item == offset)
+    {
+      slots[i].stamp = stamp;
+      hits++;
+      return cache + i*slot_sz;
+    }
+
+    if(slots[i].stamp < slots[lru].stamp)
+      lru = i;
+  }
+
+  misses++;
+  slots[lru].item = ASSET_CACHE_NO_ITEM;
+
+  if(!read_bytes(offset, cache + lru*slot_sz, len))
+    return (const uint8_t*)0;
+
+  slots[lru].item = offset;
+  slots[lru].stamp = stamp;
+  return cache + lru*slot_sz;
+}
+
+
+
+
+/**
+ * @brief Drops all cached items (call it if the pack storage is rewritten)
+ */
+void AssetPack::flush_cache()
+{
+  for(uint8_t i = 0; i < slots_num; i++)
+  {
+    slots[i].item = ASSET_CACHE_NO_ITEM;
+    slots[i].stamp = 0;
+  }
+
+  stamp = 0;
+}
+
+
+
+
+/**
+ * @brief Returns size of the bitmap
+ *
+ * @param id                          bitmap id
+ * @param width                       bitmap width (px)
+ * @param height                      bitmap height (px)
+ * @return                            "true" if the bitmap is found
+ */
+bool AssetPack::get_bitmap_size(uint16_t id, uint8_t* width, uint8_t* height)
+{
+  AssetEntry entry;
+  uint8_t header[ASSET_BITMAP_HEADER_SZ];
+
+  if(!find(ASSET_TYPE::BITMAP, id, &entry) || !read_bytes(entry.offset, header, sizeof(header)))
+    return false;
+
+  *width = header[0];
+  *height = header[1];
+  return true;
+}
+
+
+
+
+/**
+ * @brief Draws the bitmap of the pack. The bitmap is read by tiles: one page of up to "slot_sz" columns each,
+ *        tiles are cached. In immediate mode the bitmap area is sent to display
+ *
+ * @param segment                     display segment
+ * @param id                          bitmap id
+ * @param x_px                        x coordinate of the left upper corner in px (may be outside of the segment)
+ * @param y_px                        y coordinate of the left upper corner in px (may be outside of the segment)
+ * @param rop                         (optional, def = COPY) raster operation SSD1306_ROP:: [COPY, OR, AND, XOR, ANDNOT, NOT]
+ * @return                            "true" if the bitmap is drawn
+ */
+bool AssetPack::draw_bitmap(DispSegment* segment, uint16_t id, int16_t x_px, int16_t y_px, SSD1306_ROP rop)
+{
+  AssetEntry entry;
+  uint8_t header[ASSET_BITMAP_HEADER_SZ];
+
+  if(!find(ASSET_TYPE::BITMAP, id, &entry) || !read_bytes(entry.offset, header, sizeof(header)))
+    return false;
+
+  const uint8_t w = header[0];
+  const uint8_t h = header[1];
+  const uint32_t data = entry.offset + ASSET_BITMAP_HEADER_SZ;
+
+  for(uint8_t pg = 0; pg < (h + 7) / 8; pg++)
+  {
+    int16_t tile_y = y_px + pg*8;
+
+    if(tile_y >= segment->shp || tile_y + 8 <= 0)
+      continue;                                     // page is outside of the segment
+
+    for(uint16_t col = 0; col < w; col += slot_sz)
+    {
+      uint8_t tile_w = (w - col < slot_sz) ? w - col : slot_sz;
+
+      if(x_px + col >= segment->sw || x_px + col + tile_w <= 0)
+        continue;
+
+      const uint8_t* tile = fetch(data + (uint32_t)pg*w + col, tile_w);
+
+      if(tile == (const uint8_t*)0)
+        return false;
+
+      segment->blit(BlitSource(tile, tile_w, 8), DispRect{0, 0, tile_w, (int16_t)((h - pg*8 < 8) ? h - pg*8 : 8)}, x_px + col, tile_y, rop);
+    }
+  }
+
+  if(segment->immediate_update_mode_enabled())
+    segment->update_clipped(x_px, y_px, x_px + w - 1, y_px + h - 1);
+
+  return true;
+}
+
+
+
+
+/**
+ * @brief Copies the string of the string table to the buffer
+ *
+ * @param id                          string table id
+ * @param index                       string index in the table
+ * @param buf                         buffer for the string, it is always zero-terminated
+ * @param buf_sz                      buffer size (bytes). Longer strings are cut
+ * @return                            string length (bytes), 0 if there is no such string
+ */
+uint16_t AssetPack::read_string(uint16_t id, uint16_t index, char* buf, uint16_t buf_sz)
+{
+  AssetEntry entry;
+  uint8_t header[ASSET_STRINGS_HEADER_SZ];
+  uint8_t offset[4];
+  uint16_t len;
+  uint32_t str;
+
+  if(buf_sz == 0)
+    return 0;
+
+  buf[0] = 0;
+
+  if(!find(ASSET_TYPE::STRINGS, id, &entry) || !read_bytes(entry.offset, header, sizeof(header)) || index >= get_le16(header))
+    return 0;
+
+  if(!read_bytes(entry.offset + ASSET_STRINGS_HEADER_SZ + 4*(uint32_t)index, offset, sizeof(offset)))
+    return 0;
+
+  str = get_le32(offset);
+
+  if(str >= entry.size)
+    return 0;
+
+  len = (entry.size - str < buf_sz - 1u) ? entry.size - str : buf_sz - 1;
+
+  if(!read_bytes(entry.offset + str, buf, len))
+    len = 0;
+
+  buf[len] = 0;
+
+  for(len = 0; buf[len]; len++);
+
+  if(len == buf_sz - 1)                             // string may be cut: drop incomplete UTF-8 sequence at the end
+  {
+    uint16_t lead = len;
+
+    while(lead > 0 && lead > len - 4 && ((uint8_t)buf[lead - 1] & 0xC0) == 0x80)
+      lead--;
+
+    if(lead > 0 && (uint8_t)buf[lead - 1] >= 0xC0)
+    {
+      uint8_t seq_len = ((uint8_t)buf[lead - 1] >= 0xF0) ? 4 : (((uint8_t)buf[lead - 1] >= 0xE0) ? 3 : 2);
+
+      if(lead - 1 + seq_len > len)
+        buf[len = lead - 1] = 0;
+    }
+  }
+
+  return len;
+}
+
+
+
+
+/**
+ * @brief Reads font header of the pack. Zero header is returned if there is no such font
+ */
+PackFont::Header PackFont::read_header(AssetPack& asset_pack, uint16_t id)
+{
+  Header header = {0, 0, 0, 0, 0};
+  AssetEntry entry;
+  uint8_t h[ASSET_FONT_HEADER_SZ];
+
+  if(!asset_pack.find(ASSET_TYPE::FONT, id, &entry) || !asset_pack.read_bytes(entry.offset, h, sizeof(h)))
+    return header;
+
+  header.offset = entry.offset;
+  header.width = h[0];
+  header.height = h[1];
+  header.interval = h[2];
+  header.extra_num = (h[3] > FONT_EXTRA_MAX_NUM) ? FONT_EXTRA_MAX_NUM : h[3];
+  return header;
+}
+
+
+
+
+/**
+ * @brief Construct a new Pack Font. Check "is_loaded" to find out whether the font is found in the pack
+ *
+ * @param asset_pack                  opened asset pack
+ * @param id                          font id
+ */
+PackFont::PackFont(AssetPack& asset_pack, uint16_t id) : PackFont(asset_pack, read_header(asset_pack, id)){}
+
+
+
+
+PackFont::PackFont(AssetPack& asset_pack, const Header& header) :
+pack(asset_pack), glyphs(0), glyph_sz(0), word_sz((header.height <= 8) ? 1 : ((header.height <= 16) ? 2 : 4)),
+font(header.width, header.height, header.interval, load_glyph, this, extra_cps, header.extra_num)
+{
+  uint8_t cps[2*FONT_EXTRA_MAX_NUM];
+
+  if(header.offset == 0 || !pack.read_bytes(header.offset + ASSET_FONT_HEADER_SZ, cps, 2*header.extra_num))
+    return;
+
+  for(uint8_t i = 0; i < header.extra_num; i++)
+    extra_cps[i] = get_le16(cps + 2*i);
+
+  glyphs = header.offset + ASSET_FONT_HEADER_SZ + 2*header.extra_num;
+  glyph_sz = (1 + header.width) * word_sz;
+}
+
+
+
+
+/**
+ * @brief Font glyph loader: takes the glyph from the pack cache
+ */
+bool PackFont::load_glyph(void* ctx, uint8_t code, Glyph* glyph)
+{
+  PackFont* pf = (PackFont*)ctx;
+  const uint8_t* symbol;
+
+  if(pf->glyphs == 0 || code < ASSET_FONT_FIRST_CODE)
+    return false;
+
+  symbol = pf->pack.fetch(pf->glyphs + (uint32_t)(code - ASSET_FONT_FIRST_CODE)*pf->glyph_sz, pf->glyph_sz);
+
+  if(symbol == (const uint8_t*)0)
+    return false;
+
+  glyph->data = symbol + pf->word_sz;               // columns follow the width word, as in matrixFont layout
+  glyph->width = symbol[0];
+  return true;
+}
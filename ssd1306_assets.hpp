@@ -0,0 +1,93 @@
+#pragma once
+
+#include "ssd1306_display.hpp"
+#include "ssd1306_assets_format.hpp"
+
+
+// Reads "len" bytes at "offset" of the pack to "dst". Returns false on failure (or if the range is outside of the pack)
+typedef bool (*AssetReadFunc)(void* ctx, uint32_t offset, void* dst, uint16_t len);
+
+
+struct AssetEntry
+{
+    uint32_t offset;                                    // asset offset in the pack (bytes)
+    uint32_t size;                                      // asset size (bytes)
+};
+
+
+struct AssetCacheSlot
+{
+    uint32_t item;                                      // pack offset of the cached item or ASSET_CACHE_NO_ITEM
+    uint32_t stamp;                                     // last use time (for LRU replacement)
+};
+
+
+
+
+class AssetPack
+{
+    const AssetReadFunc read;
+    void* const ctx;
+    uint8_t* const cache;                               // cache buffer, slots_num * slot_sz bytes, 4 bytes aligned
+    AssetCacheSlot* const slots;
+    const uint8_t slots_num;
+    const uint16_t slot_sz;                             // size of one cache slot (bytes), multiple of 4
+
+    uint16_t entries_num;
+    uint32_t stamp;                                     // use counter
+
+    public:
+    uint32_t hits;                                      // cache statistics
+    uint32_t misses;
+
+    AssetPack(AssetReadFunc read_func, void* read_ctx, uint32_t* cache_buf, AssetCacheSlot* cache_slots, uint8_t cache_slots_num, uint16_t cache_slot_sz);
+
+    bool open();
+    bool find(ASSET_TYPE type, uint16_t id, AssetEntry* entry);
+    bool read_bytes(uint32_t offset, void* dst, uint16_t len);
+    const uint8_t* fetch(uint32_t offset, uint16_t len);
+    void flush_cache();
+
+    bool get_bitmap_size(uint16_t id, uint8_t* width, uint8_t* height);
+    bool draw_bitmap(DispSegment* segment, uint16_t id, int16_t x_px, int16_t y_px, SSD1306_ROP rop = SSD1306_ROP::COPY);
+    uint16_t read_string(uint16_t id, uint16_t index, char* buf, uint16_t buf_sz);
+
+    inline uint16_t get_slot_size(){return slot_sz;}
+};
+
+
+
+
+/**
+ * @brief Font of the asset pack. Use its "font" member with all text functions of the library.
+ *        Glyph is drawn from the pack cache: cache slot must fit (1 + width) columns of the font
+ */
+class PackFont
+{
+    AssetPack& pack;
+    uint32_t glyphs;                                    // pack offset of the first glyph (0 - no font)
+    uint16_t glyph_sz;                                  // size of one glyph in the pack (bytes)
+    uint8_t word_sz;
+    uint16_t extra_cps[FONT_EXTRA_MAX_NUM];
+
+    struct Header
+    {
+        uint32_t offset;
+        uint8_t width, height, interval, extra_num;
+    };
+
+    static Header read_header(AssetPack& asset_pack, uint16_t id);
+    static bool load_glyph(void* ctx, uint8_t code, Glyph* glyph);
+
+    PackFont(AssetPack& asset_pack, const Header& header);
+
+
+    public:
+    Font font;
+
+    PackFont(AssetPack& asset_pack, uint16_t id);
+    PackFont(const PackFont&) = delete;                 // font keeps pointers to the object
+    PackFont& operator=(const PackFont&) = delete;
+
+    inline bool is_loaded(){return glyphs != 0;}
+};
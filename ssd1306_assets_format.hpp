@@ -0,0 +1,35 @@
+#pragma once
+
+#include "stdint.h"
+
+
+/*
+ * Asset pack: one blob with fonts, bitmaps and string tables, stored outside of the MCU flash (SPI flash, SD card,
+ * file on Linux) and read by user function. Built by "ssd1306_assetc pack". All numbers are little-endian.
+ *
+ *   header    "SAP1", uint16 entries num, uint16 reserved
+ *   index     entries sorted by (type, id), 12 bytes each: uint8 type, uint8 reserved, uint16 id, uint32 offset, uint32 size
+ *   assets    FONT:    uint8 width, heigth, interval, extra_num, 4 reserved bytes; uint16 extra code points [extra_num];
+ *                      224 glyphs of codes 32 .. 255 in matrixFont layout: (1 + width) columns, the first one is glyph width
+ *             BITMAP:  uint8 width, heigth, 2 reserved bytes; page-major data (ssd1306 GRAM format)
+ *             STRINGS: uint16 count, 2 reserved bytes; uint32 offsets of the strings from the asset start [count];
+ *                      zero-terminated UTF-8 strings
+ *
+ * Glyphs and bitmap tiles (one page of up to "slot_sz" columns) are read into a small LRU cache, so the often used
+ * ones are drawn from RAM without reading the storage.
+ */
+
+
+#define ASSET_PACK_MAGIC            0x31504153          // "SAP1"
+#define ASSET_PACK_HEADER_SZ        8
+#define ASSET_ENTRY_SZ              12
+#define ASSET_FONT_HEADER_SZ        8
+#define ASSET_FONT_FIRST_CODE       32
+#define ASSET_FONT_CODES_NUM        224
+#define ASSET_BITMAP_HEADER_SZ      4
+#define ASSET_STRINGS_HEADER_SZ     4
+
+#define ASSET_CACHE_NO_ITEM         0xFFFFFFFF
+
+
+enum class ASSET_TYPE{FONT = 1, BITMAP = 2, STRINGS = 3};
@@ -16,6 +16,15 @@
    0x09: -------- 0x0A: -------- 0x0B: --------          0x09 0x0A 0x0B
 
   const uint8_t ( or uint16_t, or uint32_t) img_data[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B};
+
+  - Row-major bitmaps have to be transposed into display pages while drawing. To avoid it, declare the array "constexpr"
+    and convert it to the native PAGE-MAJOR format at compile time. Only the converted data is placed into flash:
+
+  constexpr uint8_t img_data[] = {...};
+  constexpr PageBitmapData<IMG_WIDTH, IMG_HEIGHT> img_pages = bitmap_rows_to_pages<IMG_WIDTH, IMG_HEIGHT>(img_data);
+  Bitmap img = {IMG_WIDTH, IMG_HEIGHT, img_pages.data, BITMAP_FORMAT::PAGE_MAJOR};
+
+  Page-major bitmaps drawn at y coordinate aligned to page (ROW1, ROW2, ..) are copied to GRAM by memcpy
 */
 
 
@@ -28,8 +37,9 @@
  * @param width                       width of picture in px
  * @param height                      heigth of picture in px
  * @param bitmap_ptr                  pointer to bitmap array
+ * @param bitmap_format               (optional, def = ROW_MAJOR) BITMAP_FORMAT:: [ROW_MAJOR, PAGE_MAJOR]
  */
-Bitmap::Bitmap(uint8_t width_px, uint8_t height_px, const uint8_t* bitmap_ptr) : w(width_px), h(height_px), data(bitmap_ptr){}
+Bitmap::Bitmap(uint8_t width_px, uint8_t height_px, const uint8_t* bitmap_ptr, BITMAP_FORMAT bitmap_format) : w(width_px), h(height_px), data(bitmap_ptr), format(bitmap_format){}
 
 
 
@@ -38,7 +48,7 @@ Bitmap::Bitmap(uint8_t width_px, uint8_t height_px, const uint8_t* bitmap_ptr) :
 #define BIG_CAR_WIDTH  128
 #define BIG_CAR_WIDTH_BYTES ((BIG_CAR_WIDTH / 8) + ((BIG_CAR_WIDTH%8) != 0))
 #define BIG_CAR_HEIGHT 42
-const uint8_t big_car_data[BIG_CAR_WIDTH/8 * BIG_CAR_HEIGHT] = 
+constexpr uint8_t big_car_data[BIG_CAR_WIDTH/8 * BIG_CAR_HEIGHT] = 
 {
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 
@@ -84,14 +94,16 @@ const uint8_t big_car_data[BIG_CAR_WIDTH/8 * BIG_CAR_HEIGHT] =
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
-Bitmap big_car = {BIG_CAR_WIDTH, BIG_CAR_HEIGHT, big_car_data};
+constexpr PageBitmapData<BIG_CAR_WIDTH, BIG_CAR_HEIGHT> big_car_pages = bitmap_rows_to_pages<BIG_CAR_WIDTH, BIG_CAR_HEIGHT>(big_car_data);
+
+Bitmap big_car = {BIG_CAR_WIDTH, BIG_CAR_HEIGHT, big_car_pages.data, BITMAP_FORMAT::PAGE_MAJOR};
 
 
 // Small car 60 x 20
 #define SMALL_CAR_WIDTH  60
 #define SMALL_CAR_WIDTH_BYTES ((SMALL_CAR_WIDTH / 8) + ((SMALL_CAR_WIDTH%8) != 0))
 #define SMALL_CAR_HEIGHT 20
-const uint8_t small_car_data[SMALL_CAR_WIDTH_BYTES * SMALL_CAR_HEIGHT] = 
+constexpr uint8_t small_car_data[SMALL_CAR_WIDTH_BYTES * SMALL_CAR_HEIGHT] = 
 {
 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xf0, 0x00, 0x00, 
 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xc0, 0x00, 
@@ -105,14 +117,16 @@ const uint8_t small_car_data[SMALL_CAR_WIDTH_BYTES * SMALL_CAR_HEIGHT] =
 0x01, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
-Bitmap small_car = {SMALL_CAR_WIDTH, SMALL_CAR_HEIGHT, small_car_data};
+constexpr PageBitmapData<SMALL_CAR_WIDTH, SMALL_CAR_HEIGHT> small_car_pages = bitmap_rows_to_pages<SMALL_CAR_WIDTH, SMALL_CAR_HEIGHT>(small_car_data);
+
+Bitmap small_car = {SMALL_CAR_WIDTH, SMALL_CAR_HEIGHT, small_car_pages.data, BITMAP_FORMAT::PAGE_MAJOR};
 
 
 
 #define ACCUM_WIDTH  13
 #define ACCUM_WIDTH_BYTES ((ACCUM_WIDTH / 8) + ((ACCUM_WIDTH%8) != 0))
 #define ACCUM_HEIGHT 8
-const uint8_t accum_data[ACCUM_WIDTH_BYTES*ACCUM_HEIGHT*5] = {
+constexpr uint8_t accum_data[ACCUM_WIDTH_BYTES*ACCUM_HEIGHT*5] = {
     0x7F, 0xE0, 0x80, 0x10, 0x80, 0x18, 0x80, 0x18, 0x80, 0x18, 0x80, 0x18, 0x80, 0x10, 0x7F, 0xE0,
     0x7F, 0xE0, 0x80, 0x10, 0xB0, 0x18, 0xB0, 0x18, 0xB0, 0x18, 0xB0, 0x18, 0x80, 0x10, 0x7F, 0xE0,
     0x7F, 0xE0, 0x80, 0x10, 0xB6, 0x18, 0xB6, 0x18, 0xB6, 0x18, 0xB6, 0x18, 0x80, 0x10, 0x7F, 0xE0,
@@ -120,10 +134,17 @@ const uint8_t accum_data[ACCUM_WIDTH_BYTES*ACCUM_HEIGHT*5] = {
     0x7F, 0xE0, 0x80, 0x10, 0xA7, 0x18, 0xB7, 0x98, 0x9D, 0xD8, 0x8C, 0xD8, 0x80, 0x10, 0x7F, 0xE0};
 
 
+// all 5 images are converted as one 13 x 40 picture: every image takes exactly one page
+constexpr PageBitmapData<ACCUM_WIDTH, ACCUM_HEIGHT*5> accum_pages = bitmap_rows_to_pages<ACCUM_WIDTH, ACCUM_HEIGHT*5>(accum_data);
+
 Bitmap accum[5] = {
-  {ACCUM_WIDTH, ACCUM_HEIGHT, accum_data},
-  {ACCUM_WIDTH, ACCUM_HEIGHT, accum_data+16},
-  {ACCUM_WIDTH, ACCUM_HEIGHT, accum_data+32},
-  {ACCUM_WIDTH, ACCUM_HEIGHT, accum_data+48},
-  {ACCUM_WIDTH, ACCUM_HEIGHT, accum_data+64}};
-  
\ No newline at end of file
+  {ACCUM_WIDTH, ACCUM_HEIGHT, accum_pages.data,                 BITMAP_FORMAT::PAGE_MAJOR},
+  {ACCUM_WIDTH, ACCUM_HEIGHT, accum_pages.data+ACCUM_WIDTH,     BITMAP_FORMAT::PAGE_MAJOR},
+  {ACCUM_WIDTH, ACCUM_HEIGHT, accum_pages.data+ACCUM_WIDTH*2,   BITMAP_FORMAT::PAGE_MAJOR},
+  {ACCUM_WIDTH, ACCUM_HEIGHT, accum_pages.data+ACCUM_WIDTH*3,   BITMAP_FORMAT::PAGE_MAJOR},
+  {ACCUM_WIDTH, ACCUM_HEIGHT, accum_pages.data+ACCUM_WIDTH*4,   BITMAP_FORMAT::PAGE_MAJOR}};
+
+// the same images as one strip: use "accum_sheet" cells instead of separate bitmaps
+Bitmap accum_strip = {ACCUM_WIDTH, ACCUM_HEIGHT*5, accum_pages.data, BITMAP_FORMAT::PAGE_MAJOR};
+BitmapSheet accum_sheet = {accum_strip, ACCUM_WIDTH, ACCUM_HEIGHT};
+  
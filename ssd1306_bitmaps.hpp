@@ -3,6 +3,12 @@
 #include "stdint.h"
 
 
+enum class BITMAP_FORMAT{
+    ROW_MAJOR,                                  // every byte is 8 horizontal pixels, MSB is the left one. Rows follow one after another
+    PAGE_MAJOR                                  // every byte is 8 vertical pixels, LSB is the upper one. Pages follow one after another (ssd1306 GRAM format)
+};
+
+
 class Bitmap
 {
 public:
@@ -10,15 +16,97 @@ public:
 const uint8_t w;
 const uint8_t h;
 const uint8_t* data;
+const BITMAP_FORMAT format;
+
+Bitmap(uint8_t width_px, uint8_t height_px, const uint8_t* bitmap_ptr, BITMAP_FORMAT bitmap_format = BITMAP_FORMAT::ROW_MAJOR);
+};
+
+
+
+
+/**
+ * @brief Bitmap divided into a uniform grid of cells (icon sheet, animation strip). Cells are numbered row by row
+ */
+class BitmapSheet
+{
+public:
+
+const Bitmap& bitmap;
+const uint8_t cell_w;                           // cell width (px)
+const uint8_t cell_h;                           // cell height (px)
+const uint8_t cols;                             // amount of cells in a row
+const uint8_t rows;                             // amount of cells in a column
+
+BitmapSheet(const Bitmap& sheet_bitmap, uint8_t cell_w_px, uint8_t cell_h_px) :
+    bitmap(sheet_bitmap), cell_w(cell_w_px), cell_h(cell_h_px), cols(sheet_bitmap.w / cell_w_px), rows(sheet_bitmap.h / cell_h_px){}
+
+inline uint16_t get_cells_num() const {return (uint16_t)cols * rows;}
+inline uint8_t get_cell_x(uint16_t index) const {return (index % cols) * cell_w;}
+inline uint8_t get_cell_y(uint16_t index) const {return (index / cols) * cell_h;}
+};
+
 
-Bitmap(uint8_t width_px, uint8_t height_px, const uint8_t* bitmap_ptr);
+
+
+/**
+ * @brief Transposes 8x8 bit matrix: bit "c" of byte "r" goes to bit "r" of byte "c" (bytes are taken from LSB to MSB of the word)
+ *        Uses shift/mask butterfly: 3 steps instead of 64 single bit moves
+ * 
+ * @param m                           8x8 bit matrix, byte 0 is the least significant one
+ * @return                            transposed matrix
+ */
+inline uint64_t transpose8x8(uint64_t m)
+{
+    uint64_t t;
+
+    t = (m ^ (m >> 7))  & 0x00AA00AA00AA00AAULL;  m = m ^ t ^ (t << 7);
+    t = (m ^ (m >> 14)) & 0x0000CCCC0000CCCCULL;  m = m ^ t ^ (t << 14);
+    t = (m ^ (m >> 28)) & 0x00000000F0F0F0F0ULL;  m = m ^ t ^ (t << 28);
+
+    return m;
+}
+
+
+
+
+// Storage for page-major bitmap data, see "bitmap_rows_to_pages"
+template<uint8_t W, uint8_t H>
+struct PageBitmapData
+{
+    uint8_t data[((H + 7) / 8) * W];
 };
 
 
+/**
+ * @brief Converts row-major bitmap array to page-major one at compile time
+ * 
+ * @tparam W                          width of picture in px
+ * @tparam H                          heigth of picture in px
+ * @param rows                        row-major bitmap array
+ * @return                            page-major bitmap data, use it with BITMAP_FORMAT::PAGE_MAJOR
+ */
+template<uint8_t W, uint8_t H, unsigned N>
+constexpr PageBitmapData<W, H> bitmap_rows_to_pages(const uint8_t (&rows)[N])
+{
+    static_assert(N >= ((W + 7) / 8) * H, "bitmap array is smaller than W x H");
+
+    PageBitmapData<W, H> pages{};
+
+    for(unsigned y = 0; y < H; y++)
+        for(unsigned x = 0; x < W; x++)
+            if((rows[y*((W + 7) / 8) + x/8] >> (7 - x%8)) & 0x01)
+                pages.data[(y/8)*W + x] |= 1 << (y%8);
+
+    return pages;
+}
+
+
 
 extern Bitmap big_car;
 extern Bitmap small_car;
 extern Bitmap accum[];
+extern Bitmap accum_strip;
+extern BitmapSheet accum_sheet;
 
 
 
@@ -86,7 +86,8 @@ BarChart::BarChart(DispSegment* segment, signed* last_vals, uint8_t x_px, uint8_
     x(x_px), y(y_px),
     cnum(charts_num),
     w(width_px), sp(spaceing_px), h(height_px),
-    imin(input_min), imax(input_max)
+    imin(input_min), imax(input_max),
+    pat(&PATTERN_SOLID)
     {
       for(uint8_t i = 0; i<cnum; i++)
         last_vals[i] = 0;
@@ -140,16 +141,14 @@ void BarChart::show(signed* nv, bool part_update)
       diff = nv_px - lv[ch];
       y_st =  y-nv_px+1;
       
-      for(uint8_t xch = x_pos; xch < x_pos + w; xch++)
-        ds->draw_vline(xch, y_st, diff);
+      ds->fill_area(x_pos, y_st, w, diff, *pat);
     }
     else                // убрать верхние пиксели
     {
       diff = lv[ch] - nv_px;
       y_st = y - lv[ch]+1;
     
-      for(uint8_t xch = x_pos; xch < x_pos + w; xch++)
-        ds->draw_vline(xch, y_st, diff, false);
+      ds->fill_area(x_pos, y_st, w, diff, false);
     }
     
     // for optimized screen update
@@ -187,8 +186,9 @@ void BarChart::show(signed* nv, bool part_update)
  * @param height_px                     max heigth of chart item, px 
  * @param input_min                     minimum input numer corresponds to zero chart level          
  * @param input_max                     maximum input number corresponds to "height_px" chart level
+ * @param pattern                       (optional, def = PATTERN_SOLID) bars fill pattern
  */
-void BarChart::draw(DispSegment* segment, signed* nv, uint8_t x_px, uint8_t y_px, uint8_t charts_num, uint8_t width_px, uint8_t spaceing_px, uint8_t height_px, signed input_min, signed input_max)
+void BarChart::draw(DispSegment* segment, signed* nv, uint8_t x_px, uint8_t y_px, uint8_t charts_num, uint8_t width_px, uint8_t spaceing_px, uint8_t height_px, signed input_min, signed input_max, const FillPattern &pattern)
 {
   uint8_t x_pos = x_px;
   uint8_t y_up = y_px - height_px + 1;
@@ -203,16 +203,12 @@ void BarChart::draw(DispSegment* segment, signed* nv, uint8_t x_px, uint8_t y_px
     rest_px = height_px - nv_px;
 
 
-    for(uint8_t xch = x_pos; xch < x_pos + width_px; xch++)
-    {
-      segment->draw_vline(xch, y_up, rest_px, false);
-      segment->draw_vline(xch, y_st, nv_px);
-    }
+    segment->fill_area(x_pos, y_up, width_px, rest_px, false);
+    segment->fill_area(x_pos, y_st, width_px, nv_px, pattern);
 
     x_pos += width_px;
 
-    for(uint8_t xch = x_pos; xch < x_pos + spaceing_px; xch++)
-      segment->draw_vline(xch, y_up, height_px, false);
+    segment->fill_area(x_pos, y_up, spaceing_px, height_px, false);
 
     x_pos += spaceing_px;
   }
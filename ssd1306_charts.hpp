@@ -12,6 +12,7 @@ class BarChart
 
     uint8_t cnum;           // charts num
     signed imin, imax;      // min & max values of charts input values
+    const FillPattern* pat; // bars fill pattern
 
 
 
@@ -32,10 +33,11 @@ class BarChart
     void init_with_fit_into_segment(DispSegment* segment, signed* last_vals, uint8_t charts_num, uint8_t spaceing_px, signed input_min, signed input_max);
 
     inline void set_input_range(signed input_min, signed input_max){imin = input_min; imax = input_max;}
+    inline void set_pattern(const FillPattern &pattern){pat = &pattern;}
 
     void show(signed* nv, bool part_update = false);
 
-    static void draw(DispSegment* segment, signed* nv, uint8_t x_px, uint8_t y_px, uint8_t charts_num, uint8_t width_px, uint8_t spaceing_px, uint8_t height_px, signed input_min, signed input_max);
+    static void draw(DispSegment* segment, signed* nv, uint8_t x_px, uint8_t y_px, uint8_t charts_num, uint8_t width_px, uint8_t spaceing_px, uint8_t height_px, signed input_min, signed input_max, const FillPattern &pattern = PATTERN_SOLID);
     static void draw(DispSegment* segment, signed* nv, uint8_t charts_num, uint8_t spaceing_px);
     static void draw(DispSegment* segment, signed* nv, uint8_t charts_num, uint8_t spaceing_px, signed input_min, signed input_max);
 };
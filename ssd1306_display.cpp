@@ -19,7 +19,7 @@
 */
 
 #include <stdlib.h>
-#include <stdio.h>
+#include <string.h>
 
 #include "ssd1306_display.hpp"
 
@@ -28,6 +28,54 @@
 uint8_t DispLayout::layouts_qnt = 0;
 
 
+// sin(0 .. 90 deg) * 255, used to calculate arc directions
+static const uint8_t quarter_sine[91] = {
+    0,   4,   9,  13,  18,  22,  27,  31,  35,  40,  44,  49,  53,  57,  62,  66,
+   70,  75,  79,  83,  87,  91,  96, 100, 104, 108, 112, 116, 120, 124, 127, 131,
+  135, 139, 143, 146, 150, 153, 157, 160, 164, 167, 171, 174, 177, 180, 183, 186,
+  190, 192, 195, 198, 201, 204, 206, 209, 211, 214, 216, 219, 221, 223, 225, 227,
+  229, 231, 233, 235, 236, 238, 240, 241, 243, 244, 245, 246, 247, 248, 249, 250,
+  251, 252, 253, 253, 254, 254, 254, 255, 255, 255, 255
+};
+
+
+/**
+  * @brief Returns sine of the angle multiplied by 255
+  * @param deg                         angle in degrees
+*/
+static int16_t sin_deg(uint16_t deg)
+{
+  deg %= 360;
+
+  if(deg <= 90)  return  quarter_sine[deg];
+  if(deg <= 180) return  quarter_sine[180 - deg];
+  if(deg <= 270) return -quarter_sine[deg - 180];
+  return -quarter_sine[360 - deg];
+}
+
+
+/**
+  * @brief Returns cosine of the angle multiplied by 255
+  * @param deg                         angle in degrees
+*/
+static int16_t cos_deg(uint16_t deg)
+{
+  return sin_deg(deg % 360 + 90);
+}
+
+
+
+/**
+* @brief Reverses bit order in byte (MSB <-> LSB)
+*/
+static inline uint8_t reverse_bits8(uint8_t b)
+{
+  static const uint8_t nibble_rev[16] = {0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE, 0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF};
+
+  return (nibble_rev[b & 0x0F] << 4) | nibble_rev[b >> 4];
+}
+
+
 /**
   * @brief Create new layout
   * 
@@ -54,9 +102,11 @@ DispLayout* DispLayout::create_layout(SSD1306_Display& display){
  * @param page_start_pg               y start of the segment in display coordinates in pages
  * @param col_end_px                  x end of the segment in display coordinates in px (end is included in segment)
  * @param page_end_pg                 y end of the segment in display coordinates in pages (end is included in segment)
+ * @param rotation                    (optional, def = R0) software rotation of segment content SSD1306_ROTATION:: [R0, R90, R180, R270]
+ *                                    For R90 and R270 segment width must be a multiple of 8. Address mode of rotated segment determines only its memory layout
  * @return                            Return pointer to new DispSegment object
  */
-DispSegment* DispLayout::create_segment(SSD1306_ADDR_MODE addr_mode, uint8_t col_start_px, uint8_t page_start_pg, uint8_t col_end_px, uint8_t page_end_pg){
+DispSegment* DispLayout::create_segment(SSD1306_ADDR_MODE addr_mode, uint8_t col_start_px, uint8_t page_start_pg, uint8_t col_end_px, uint8_t page_end_pg, SSD1306_ROTATION rotation){
   unsigned segment_size;
   uint8_t* segment_gram_ptr;
 
@@ -69,6 +119,9 @@ DispSegment* DispLayout::create_segment(SSD1306_ADDR_MODE addr_mode, uint8_t col
   if(page_start_pg > page_end_pg || page_end_pg >= disp.HEIGHT_PG)
     while(1);
 
+  if((rotation == SSD1306_ROTATION::R90 || rotation == SSD1306_ROTATION::R270) && ((col_end_px - col_start_px + 1) % 8))
+    while(1);                                                                 // rotated segment width must be aligned on pages
+
   segment_size = (page_end_pg - page_start_pg + 1) * (col_end_px - col_start_px + 1);
 
   if(segment_size > gram_available)
@@ -78,7 +131,7 @@ DispSegment* DispLayout::create_segment(SSD1306_ADDR_MODE addr_mode, uint8_t col
     curr_segment_gram_ptr += segment_size;
     gram_available -= segment_size;
 
-  return new DispSegment(id+segments_qnt++, addr_mode, col_start_px, page_start_pg, col_end_px, page_end_pg, disp, segment_gram_ptr, segment_size);
+  return new DispSegment(id+segments_qnt++, addr_mode, col_start_px, page_start_pg, col_end_px, page_end_pg, disp, segment_gram_ptr, segment_size, rotation);
 }
 
 
@@ -275,29 +328,363 @@ void DispSegment::draw_pixel(uint8_t x_px, uint8_t y_px, bool px_en)
 
 
 
+/**
+* @brief Fills rectangular area of the segment. Works with whole bytes: page masks of the first and last page are calculated once,
+*        the pages between them are filled by memset. Area is clipped by segment borders, so coordinates may be negative.
+*
+* @note Like "draw_pixel" it is a primitive, so it never updates the screen by itself
+*
+* @param[in] x_px                     x coordinate of the left upper corner in px
+* @param[in] y_px                     y coordinate of the left upper corner in px
+* @param[in] w_px                     width of the area in px
+* @param[in] h_px                     height of the area in px
+* @param[in] color_noinv              (optional, def = true) true - pixels are on, false - pixels are off
+*/
+void DispSegment::fill_area(int16_t x_px, int16_t y_px, int16_t w_px, int16_t h_px, bool color_noinv)
+{
+  if(x_px < 0) {w_px += x_px; x_px = 0;}
+  if(y_px < 0) {h_px += y_px; y_px = 0;}
+  if(x_px + w_px > sw) w_px = sw - x_px;
+  if(y_px + h_px > shp) h_px = shp - y_px;
+
+  if(w_px <= 0 || h_px <= 0)
+    return;
+
+  uint8_t start_page = y_px >> 3;
+  uint8_t end_page = (y_px + h_px - 1) >> 3;
+  uint8_t first_mask = 0xFF << (y_px % 8);
+  uint8_t last_mask = 0xFF >> (7 - ((y_px + h_px - 1) % 8));
+  uint8_t fill = color_noinv ? 0xFF : 0x00;
+
+  if(start_page == end_page)
+    first_mask &= last_mask;
+
+  if(addr_mode == SSD1306_ADDR_MODE::VERTICAL)
+  {
+    // pages of one column are neighbours in memory
+    for(uint8_t col = x_px; col < x_px + w_px; col++)
+    {
+      uint8_t* col_ptr = &gram[col*sh + start_page];
+
+      color_noinv ? (*col_ptr |= first_mask) : (*col_ptr &= ~first_mask);
+
+      if(start_page == end_page)
+        continue;
+
+      memset(col_ptr + 1, fill, end_page - start_page - 1);
+      color_noinv ? (col_ptr[end_page - start_page] |= last_mask) : (col_ptr[end_page - start_page] &= ~last_mask);
+    }
+  }
+  else
+  {
+    // columns of one page are neighbours in memory
+    uint8_t* row_ptr = &gram[start_page*sw + x_px];
+
+    for(uint8_t col = 0; col < w_px; col++)
+      color_noinv ? (row_ptr[col] |= first_mask) : (row_ptr[col] &= ~first_mask);
+
+    if(start_page == end_page)
+      return;
+
+    for(uint8_t pg = start_page + 1; pg < end_page; pg++)
+      memset(&gram[pg*sw + x_px], fill, w_px);
+
+    row_ptr = &gram[end_page*sw + x_px];
+    for(uint8_t col = 0; col < w_px; col++)
+      color_noinv ? (row_ptr[col] |= last_mask) : (row_ptr[col] &= ~last_mask);
+  }
+}
+
+
+
+
+/**
+* @brief Fills rectangular area of the segment with 8x8 pattern. Pattern byte of the column is written with the same page masks
+*        as solid fill, so the fill costs the same. Pattern is bound to segment coordinates: neighbouring areas are joined seamlessly.
+*        Area is clipped by segment borders, so coordinates may be negative.
+*
+* @note Like "draw_pixel" it is a primitive, so it never updates the screen by itself
+*
+* @param[in] x_px                     x coordinate of the left upper corner in px
+* @param[in] y_px                     y coordinate of the left upper corner in px
+* @param[in] w_px                     width of the area in px
+* @param[in] h_px                     height of the area in px
+* @param[in] pattern                  fill pattern (PATTERN_SOLID, PATTERN_BAYER50, PATTERN_HATCH, ...)
+*/
+void DispSegment::fill_area(int16_t x_px, int16_t y_px, int16_t w_px, int16_t h_px, const FillPattern &pattern)
+{
+  bool uniform = true;
+
+  for(uint8_t i = 1; i < 8; i++)
+    if(pattern.col[i] != pattern.col[0])
+      uniform = false;
+
+  if(uniform && (pattern.col[0] == 0xFF || pattern.col[0] == 0x00))
+  {
+    fill_area(x_px, y_px, w_px, h_px, pattern.col[0] != 0x00);          // solid fill by memset
+    return;
+  }
+
+  if(x_px < 0) {w_px += x_px; x_px = 0;}
+  if(y_px < 0) {h_px += y_px; y_px = 0;}
+  if(x_px + w_px > sw) w_px = sw - x_px;
+  if(y_px + h_px > shp) h_px = shp - y_px;
+
+  if(w_px <= 0 || h_px <= 0)
+    return;
+
+  uint8_t start_page = y_px >> 3;
+  uint8_t end_page = (y_px + h_px - 1) >> 3;
+  uint8_t first_mask = 0xFF << (y_px % 8);
+  uint8_t last_mask = 0xFF >> (7 - ((y_px + h_px - 1) % 8));
+  uint16_t step = col_step();
+
+  if(start_page == end_page)
+    first_mask &= last_mask;
+
+  for(uint8_t pg = start_page; pg <= end_page; pg++)
+  {
+    uint8_t mask = (pg == start_page) ? first_mask : ((pg == end_page) ? last_mask : 0xFF);
+    uint8_t* dst = page_ptr(x_px, pg);
+
+    for(uint8_t col = 0; col < w_px; col++, dst += step)
+      *dst = (*dst & ~mask) | (pattern.col[(x_px + col) & 0x07] & mask);
+  }
+}
+
+
+
+
+/**
+* @brief Writes pixel column into the segment: bits are shifted to the page of "y_px" and written to the affected page bytes
+*        (up to 9 bytes for 64 bits) with one mask per byte. All "height" pixels are written: set bits are drawn with color, others - with background
+*
+* @param[in] x_px                     x coordinate of the column in px
+* @param[in] y_px                     y coordinate of the upper pixel in px
+* @param[in] bits                     pixels of the column, bit 0 is the upper pixel
+* @param[in] height                   amount of pixels in column [1 .. 64]
+* @param[in] color_noinv              determines color no inversion
+*/
+void DispSegment::put_column(int16_t x_px, int16_t y_px, uint64_t bits, uint8_t height, bool color_noinv)
+{
+  uint64_t mask = (height >= 64) ? ~0ULL : ((1ULL << height) - 1);
+
+  if(x_px < 0 || x_px >= sw || y_px >= shp || height == 0 || y_px <= -(int16_t)height)
+    return;
+
+  if(!color_noinv)
+    bits = ~bits;
+  bits &= mask;
+
+  if(y_px < 0)
+  {
+    bits >>= -y_px;
+    mask >>= -y_px;
+    y_px = 0;
+  }
+
+  uint8_t pg = y_px >> 3;
+  uint8_t shift = y_px % 8;
+  uint16_t step = page_step();
+  uint8_t* dst = page_ptr(x_px, pg);
+
+  // first page: bits are shifted down to "y_px"
+  uint8_t m = (uint8_t)(mask << shift);
+  *dst = (*dst & ~m) | (uint8_t)(bits << shift);
+
+  bits >>= 8 - shift;
+  mask >>= 8 - shift;
+
+  // next pages: whole bytes
+  while(mask && ++pg < sh)
+  {
+    dst += step;
+    m = (uint8_t)mask;
+    *dst = (*dst & ~m) | (uint8_t)bits;
+
+    bits >>= 8;
+    mask >>= 8;
+  }
+}
+
+
+
+
+// Bit spreading tables for scaled fonts: every bit of nibble is repeated S times (nibble -> byte for 2x, -> 12 bits for 3x, -> 16 bits for 4x)
+template<uint8_t S>
+struct SpreadTable
+{
+  uint16_t v[16];
+};
+
+template<uint8_t S>
+constexpr SpreadTable<S> make_spread_table()
+{
+  SpreadTable<S> t{};
+
+  for(uint8_t n = 0; n < 16; n++)
+    for(uint8_t b = 0; b < 4; b++)
+      if((n >> b) & 0x01)
+        t.v[n] |= ((1 << S) - 1) << (b*S);
+
+  return t;
+}
+
+static constexpr SpreadTable<2> spread_x2 = make_spread_table<2>();
+static constexpr SpreadTable<3> spread_x3 = make_spread_table<3>();
+static constexpr SpreadTable<4> spread_x4 = make_spread_table<4>();
+
+
+
+
+/**
+* @brief Repeats every bit of the glyph column "scale" times: 0b101 scaled by 2 gives 0b110011
+* @param[in] bits                     glyph column
+* @param[in] n_bits                   amount of bits in column
+* @param[in] scale                    scale, result must fit in 64 bits
+* @return                             scaled column
+*/
+static uint64_t spread_bits(uint32_t bits, uint8_t n_bits, uint8_t scale)
+{
+  const uint16_t* table;
+  uint64_t out = 0;
+
+  switch(scale)
+  {
+    case 1:   return bits;
+    case 2:   table = spread_x2.v;  break;
+    case 3:   table = spread_x3.v;  break;
+    case 4:   table = spread_x4.v;  break;
+
+    default:
+      for(uint8_t k = 0; k < n_bits; k++)
+        if((bits >> k) & 0x01)
+          out |= ((1ULL << scale) - 1) << (k*scale);
+      return out;
+  }
+
+  for(uint8_t k = 0; k < n_bits; k += 4)
+    out |= (uint64_t)table[(bits >> k) & 0x0F] << (k*scale);
+
+  return out;
+}
+
+
+
+
+/**
+* @brief Rotates glyph counterclockwise: builds pixel columns of the vertical text glyph from the glyph columns.
+*        Bit k of rows[j] is bit j of glyph column (width - 1 - k). Glyph columns are read once, in order, 
+*        by groups of 8 columns, every group is processed by 8x8 blocks with bit transpose
+* @param[in] glyph                    font glyph (columns stream)
+* @param[in] height                   font height [1 .. 32]
+* @param[out] rows                    "height" pixel columns of the rotated glyph, bit 0 is the upper pixel
+*/
+static void rotate_glyph_ccw(Glyph glyph, uint8_t height, uint32_t* rows)
+{
+  uint32_t cols[8];
+  uint64_t m, t;
+  uint8_t k;
+
+  for(uint8_t j = 0; j < height; j++)
+    rows[j] = 0;
+
+  for(uint8_t g = 0; g < glyph.width; g += 8)                     // 8 glyph columns group
+  {
+    for(uint8_t r = 0; r < 8; r++)
+      cols[r] = (g + r < glyph.width) ? glyph.next_column() : 0;
+
+    for(uint8_t s = 0; s < height; s += 8)                        // 8 bits slice of glyph columns
+    {
+      m = 0;
+
+      // column (g + r) goes to bit k = width - 1 - g - r, so the group is reversed: byte 7 - r of the block
+      for(uint8_t r = 0; r < 8; r++)
+        m |= (uint64_t)((cols[r] >> s) & 0xFF) << (8*(7 - r));
+
+      t = transpose8x8(m);
+
+      // bit b of the block row is bit k = width - 1 - g - 7 + b
+      k = glyph.width - g;
+      for(uint8_t j = 0; j < 8 && s + j < height; j++)
+        rows[s + j] |= (k >= 8) ? (uint32_t)((t >> (8*j)) & 0xFF) << (k - 8) : (uint32_t)((t >> (8*j)) & 0xFF) >> (8 - k);
+    }
+  }
+}
+
+
+
+
+/**
+* @brief Draws glyph, clipped by the rectangle. Font scale is applied
+* @param[in] x_px                     x coordinate of the glyph in px
+* @param[in] y_px                     y coordinate of the glyph in px
+* @param[in] glyph                    glyph of the font (columns stream)
+* @param[in] font                     font of the glyph
+* @param[in] clip                     clip rectangle, must be inside of the segment
+* @param[in] color_noinv              determines color no inversion
+*/
+void DispSegment::put_glyph(int16_t x_px, int16_t y_px, Glyph glyph, Font &font, const DispRect &clip, bool color_noinv)
+{
+  int16_t top = (y_px > clip.y) ? y_px : clip.y;
+  int16_t bottom = (y_px + font.height < clip.y + clip.h) ? y_px + font.height : clip.y + clip.h;
+  int16_t cx;
+  uint64_t bits;
+
+  if(top >= bottom || font.height > 64)
+    return;
+
+  for(uint8_t i = 0; i < glyph.width; i++)
+  {
+    bits = spread_bits(glyph.next_column(), font.height / font.scale, font.scale) >> (top - y_px);
+
+    for(uint8_t r = 0; r < font.scale; r++)
+    {
+      cx = x_px + i*font.scale + r;
+      if(cx >= clip.x && cx < clip.x + clip.w)
+        put_column(cx, top, bits, bottom - top, color_noinv);
+    }
+  }
+}
+
+
+
+
 /**
  * @brief Write char to the current place in display segment
  * 
- * @param ch                          char to be writed
+ * @param ch                          char to be writed: glyph code (Windows 1251 code or code returned by "Font::read_code")
  * @param font                        font that determines clear height
  * @param color_noinv                 (optional, def = true) determines color no inversion
  * @param no_interval                 (optional, def = false) if "true", then it does not add intercharacter spacing
  */
 bool DispSegment::write_char(char ch, Font &font, bool color_noinv, bool no_interval)
 {
-  unsigned symbol;
-  uint8_t width = font.get_symbol_width(ch);
+  Glyph glyph = font.get_glyph(ch);
+  uint8_t width = glyph.width * font.scale;
+  uint8_t glyph_height = font.height / font.scale;
+  uint64_t bits;
 
   if(text_vertical_mode == false)
   {
-    if(!check_font(width, font.height))                                       
+    if(!check_font(width, font.height) || font.height > 64)                                       
     return false;                                                                      // Not enouth space to write char
 
-    for(unsigned i = 0; i < width; i++) 
+    if(font.scale == 1)
+    {
+      for(unsigned i = 0; i < width; i++) 
+        put_column(x + i, y, glyph.next_column(), font.height, color_noinv);
+    }
+    else
     {
-      symbol = font.get_column(ch, i);
-      for(unsigned j = 0; j < font.height; j++)
-        ((symbol >> j) & 0x01) ? draw_pixel(x + i, (y + j), color_noinv) : draw_pixel(x + i, (y + j), !color_noinv);
+      // Scaled font: every glyph column is spread vertically and repeated "scale" times
+      for(unsigned i = 0; i < glyph.width; i++) 
+      {
+        bits = spread_bits(glyph.next_column(), glyph_height, font.scale);
+
+        for(unsigned r = 0; r < font.scale; r++)
+          put_column(x + i*font.scale + r, y, bits, font.height, color_noinv);
+      }
     }
     
     x += width;
@@ -306,8 +693,7 @@ bool DispSegment::write_char(char ch, Font &font, bool color_noinv, bool no_inte
       return true;
 
     for(unsigned i = 0; i < font.interval; i++) 
-      for(unsigned j = 0; j < font.height; j++)
-        draw_pixel(x + i, (y + j), !color_noinv);
+      put_column(x + i, y, 0, font.height, color_noinv);
 
         
       // The current space is now taken
@@ -317,27 +703,25 @@ bool DispSegment::write_char(char ch, Font &font, bool color_noinv, bool no_inte
   else
   {
 
-    if(!check_vfont(width, font.height))                                       
+    uint8_t gap = no_interval ? 0 : font.interval;                                      // intercharacter spacing is written above the glyph
+
+    if(!check_vfont(width, font.height) || width + gap > 64)                                       
       return false;                                                                      // Not enouth space to write char
 
-    for(unsigned i = 0; i < width; i++) 
+    // Glyph is rotated counterclockwise: its column i becomes row (y - i), so each segment column (x + j) is written by one "put_column"
+    uint32_t rows[32];
+    rotate_glyph_ccw(glyph, glyph_height, rows);
+
+    for(unsigned j = 0; j < glyph_height; j++)
     {
-      symbol = font.get_column(ch, i);
-      for(unsigned j = 0; j < font.height; j++)
-        ((symbol >> j) & 0x01) ? draw_pixel(x + j, (y - i), color_noinv) : draw_pixel(x + j, (y - i), !color_noinv);
+      bits = spread_bits(rows[j], glyph.width, font.scale) << gap;
+
+      for(unsigned r = 0; r < font.scale; r++)
+        put_column(x + j*font.scale + r, (int16_t)y - width - gap + 1, bits, width + gap, color_noinv);
     }
     
-    y -= width;
-
-    if(no_interval)
-      return true;
-
-    for(unsigned i = 0; i < font.interval; i++) 
-      for(unsigned j = 0; j < font.height; j++)
-        draw_pixel(x + j, (y + i), !color_noinv);
-
     // The current space is now taken
-    y -= font.interval;
+    y -= width + gap;
     return true;
   }
 }
@@ -350,21 +734,21 @@ bool DispSegment::write_char(char ch, Font &font, bool color_noinv, bool no_inte
  * 
  * @param x_px                        x coordinate in px
  * @param y_px                        y coordinate in px
- * @param str                         string to be displayed
+ * @param str                         string to be displayed (UTF-8 or Windows 1251)
  * @param font                        font that determines clear height
  * @param color_noinv                 (optional, def = true) determines color no inversion
  */
 void DispSegment::write_string(uint8_t x_px, uint8_t y_px, const char* str, Font &font, bool color_noinv)
 {
+  char code;
+
   if(!set_cursor(x_px, y_px))                      // Bad coordinates
     return;
 
-  while (*str)                              // Write until null-byte
+  while((code = font.read_code(&str)))              // Write until null-byte, UTF-8 sequences are decoded on the fly
   {
-      if (!write_char(*str, font, color_noinv)) 
+      if (!write_char(code, font, color_noinv)) 
           return;                           // Char could not be written
-      
-      str++;                                // Next char
   }
 }
 
@@ -382,161 +766,550 @@ void DispSegment::write_string(uint8_t x_px, uint8_t y_px, const char* str, Font
  */
 void DispSegment::write_string_now(uint8_t x_px, uint8_t y_px, const char* str, Font &font, bool color_noinv)
 {
+  if(!check_cursor(x_px, y_px))                    // Bad coordinates
+    return;
+
   write_string(x_px, y_px, str, font, color_noinv);
-  update_part(x_px, y_px, x_px + get_string_size_px(str, font) - 1, y_px + font.height - 1);
+
+  if(text_vertical_mode == false)                  // Cursor stands after the last written char, so string is not measured again
+    update_clipped(x_px, y_px, x - 1, y_px + font.height - 1);
+  else
+    update_clipped(x_px, y + 1, x_px + font.height - 1, y_px);
 }
 
 
 
 
 /**
- * @brief Write numerical to the specified place in display segment
+ * @brief Writes measured string to the specified place in display segment
  * 
  * @param x_px                        x coordinate in px
  * @param y_px                        y coordinate in px
- * @param num                         num to be displayed
- * @param font                        font that determines clear height
+ * @param mstr                        measured string to be displayed
  * @param color_noinv                 (optional, def = true) determines color no inversion
  */
-void DispSegment::write_num(uint8_t x_px, uint8_t y_px, signed num, Font &font, bool color_noinv)
+void DispSegment::write_string(uint8_t x_px, uint8_t y_px, const MeasuredString &mstr, bool color_noinv)
 {
-  char sbuf[10];
-  sprintf(sbuf, "%d", num);
-
-  write_string(x_px, y_px, sbuf, font, color_noinv);
+  write_string(x_px, y_px, mstr.str, mstr.font, color_noinv);
 }
 
 
 
 
-
 /**
- * @brief Write numerical with space or minus sign to the specified place in display segment
+ * @brief Writes measured string to the specified place in display segment. Shows it IMMEDIATLY
  * 
  * @param x_px                        x coordinate in px
  * @param y_px                        y coordinate in px
- * @param num                         num to be displayed
- * @param font                        font that determines clear height
+ * @param mstr                        measured string to be displayed
  * @param color_noinv                 (optional, def = true) determines color no inversion
  */
-void DispSegment::write_num_sign(uint8_t x_px, uint8_t y_px, signed num, Font &font, bool color_noinv)
+void DispSegment::write_string_now(uint8_t x_px, uint8_t y_px, const MeasuredString &mstr, bool color_noinv)
 {
-  char sbuf[10];
-  sprintf(sbuf, "% d", num);
-
-  write_string(x_px, y_px, sbuf, font, color_noinv);
+  write_string_now(x_px, y_px, mstr.str, mstr.font, color_noinv);
 }
 
 
 
 
 /**
- * @brief Write numerical to the specified place in display segment. Shows it IMMEDIATLY
+ * @brief Draws static label (string rasterized at compile time, see "SSD1306_STATIC_LABEL") by one blit.
+ *        The whole label box is drawn, so intercharacter spacing gets the background color (inverted label paints
+ *        the gaps too), unlike "write_string" which leaves the gaps as is
  * 
- * @param x_px                        x coordinate in px
- * @param y_px                        y coordinate in px
- * @param num                         num to be displayed
- * @param font                        font that determines clear height
+ * @param x_px                        x coordinate in px (may be outside of the segment)
+ * @param y_px                        y coordinate in px (may be outside of the segment)
+ * @param label                       static label
  * @param color_noinv                 (optional, def = true) determines color no inversion
  */
-void DispSegment::write_num_now(uint8_t x_px, uint8_t y_px, signed num, Font &font, bool color_noinv)
+void DispSegment::write_label(int16_t x_px, int16_t y_px, const StaticLabel &label, bool color_noinv)
 {
-  char sbuf[10];
-  sprintf(sbuf, "%d", num);
-
-  write_string_now(x_px, y_px, sbuf, font, color_noinv);
+  blit(BlitSource(label.data, label.w, label.h), x_px, y_px, color_noinv ? SSD1306_ROP::COPY : SSD1306_ROP::NOT);
 }
 
 
 
 
+
 /**
- * @brief Clears the specified font by a certain number of pixels horizontally
+ * @brief Finds the end of the text box row and measures it
  * 
- * @param x_px                        x coordinate in px
- * @param y_px                        y coordinate in px
- * @param sz_px                       amount of pixels to be cleared
- * @param font                        font that determines clear height
- * @param color_noinv                 (optional, def = true) determines color no inversion
+ * @param str                         row start
+ * @param font                        font
+ * @param max_w                       box width, row is wrapped if it is wider
+ * @param wrap                        wrap row by words (by chars if word is longer than the box)
+ * @param end                         [out] end of the row chars
+ * @param next                        [out] start of the next row
+ * @return                            row width in px
  */
-void DispSegment::clear_font_px(uint8_t x_px, uint8_t y_px, uint8_t sz_px, Font &font, bool color_noinv)
-{  
-  if(!set_cursor(x_px, y_px))                      // Bad coordinates
-    return;
-   
-   for(unsigned i = x_px; i < x_px + sz_px; i++)
-     for(unsigned j = y_px; j < y_px + font.height; j++)
-       draw_pixel(i, j, !color_noinv);
+static int16_t measure_text_row(const char* str, Font &font, int16_t max_w, bool wrap, const char** end, const char** next)
+{
+  const char* p = str;
+  const char* q;
+  const char* brk = (const char*)0;                 // last space in the row
+  int16_t brk_w = 0;                                // row width before the last space
+  int16_t w = 0;
+  int16_t nw;
+  char code;
+
+  while(*p && *p != '\n')
+  {
+    q = p;
+    code = font.read_code(&q);
+    nw = (p == str) ? font.get_symbol_width(code) : w + font.interval + font.get_symbol_width(code);
+
+    if(wrap && nw > max_w && p != str)
+    {
+      if(*p == ' ')                                 // the space which does not fit is the break itself
+      {
+        brk = p;
+        brk_w = w;
+      }
+
+      if(brk)
+      {
+        *end = brk;
+        for(p = brk; *p == ' '; p++);              // spaces at the break are not shown
+        *next = (*p == '\n') ? p + 1 : p;          // the row is already ended by the break
+        return brk_w;
+      }
+
+      *end = *next = p;
+      return w;
+    }
+
+    if(*p == ' ')
+    {
+      brk = p;
+      brk_w = w;
+    }
+
+    w = nw;
+    p = q;
+  }
+
+  *end = p;
+  *next = (*p == '\n') ? p + 1 : p;
+  return w;
 }
 
 
 
 
 /**
- * @brief Clears symbol of the specified font
+ * @brief Writes text into the box: rows are aligned, wrapped by words and clipped by the box, text that does not fit may be replaced with ellipsis.
+ *        The box is cleared before drawing. '\n' starts new row. Rows are placed one under another with font height step.
+ *        Every row is measured once with cached glyph widths. Text is always horizontal
  * 
- * @param x_px                        x coordinate of symbol in px
- * @param y_px                        y coordinate of symbol in px
- * @param font                        font that determines clear height
+ * @param box                         text box (clip rectangle), may be partially outside of the segment
+ * @param str                         text
+ * @param font                        font
+ * @param align                       (optional, def = LEFT) rows alignment SSD1306_TEXT_ALIGN:: [LEFT, CENTER, RIGHT]
+ * @param flags                       (optional, def = TEXT_WRAP) combination of SSD1306_TEXT_FLAGS [TEXT_CLIP, TEXT_WRAP, TEXT_ELLIPSIS]
  * @param color_noinv                 (optional, def = true) determines color no inversion
+ * @return                            bounding box of the drawn text (w = 0 if nothing is drawn). Use it to update only the changed area
  */
-void DispSegment::clear_font_symb(uint8_t x_px, uint8_t y_px, uint8_t sz_symb, Font &font, bool color_noinv){
-  clear_font_px(x_px, y_px, sz_symb*(font.width + font.interval)-font.interval, font, color_noinv);
+DispRect DispSegment::write_text_box(const DispRect &box, const char* str, Font &font, SSD1306_TEXT_ALIGN align, uint8_t flags, bool color_noinv)
+{
+  return write_text_rows(box, str, font, -1, align, flags, color_noinv);
 }
 
 
 
 
 /**
- * @brief Clears string row of the specified font
+ * @brief Writes measured string into the box (see "write_text_box" above). One row string which fits the box is aligned 
+ *        by its cached width without measuring (strings of "StringTable"), other strings are measured as usual
  * 
- * @param y_px                        row coordinates in px
- * @param font                        font that determines clear height
+ * @param box                         text box (clip rectangle), may be partially outside of the segment
+ * @param mstr                        measured string
+ * @param align                       (optional, def = LEFT) rows alignment SSD1306_TEXT_ALIGN:: [LEFT, CENTER, RIGHT]
+ * @param flags                       (optional, def = TEXT_WRAP) combination of SSD1306_TEXT_FLAGS [TEXT_CLIP, TEXT_WRAP, TEXT_ELLIPSIS]
  * @param color_noinv                 (optional, def = true) determines color no inversion
+ * @return                            bounding box of the drawn text (w = 0 if nothing is drawn)
  */
-void DispSegment::clear_font_row(uint8_t y_px, Font &font, bool color_noinv){
-  clear_font_px(0, y_px, sw, font, color_noinv);
-}
-
+DispRect DispSegment::write_text_box(const DispRect &box, const MeasuredString &mstr, SSD1306_TEXT_ALIGN align, uint8_t flags, bool color_noinv)
+{
+  const char* p;
 
-            
+  for(p = mstr.str; *p && *p != '\n'; p++);
 
-/**
-* @brief Returns size of the specified string, written in specified font, in pixels
-* @param[in] str                       string
-* @param[in] font                      font
-*/
-uint8_t DispSegment::get_string_size_px(const char* str, Font &font)
-{
-  uint8_t size_px = 0;
-  
-  while (*str) 
-    size_px += font.get_symbol_width(*str++) + font.interval;
-  
-  return size_px - font.interval;
+  return write_text_rows(box, mstr.str, mstr.font, *p ? -1 : mstr.width_px, align, flags, color_noinv);
 }
 
 
 
 
-
 /**
-* @brief Returns size of the specified number, written in specified font, in pixels
+ * @brief Writes text into the box, see "write_text_box"
+ * 
+ * @param str_w                       width of one row string or -1 if it is not known
+ */
+DispRect DispSegment::write_text_rows(const DispRect &box, const char* str, Font &font, int16_t str_w, SSD1306_TEXT_ALIGN align, uint8_t flags, bool color_noinv)
+{
+  DispRect bbox = {0, 0, 0, 0};
+  DispRect clip = box;
+  const char* end;
+  const char* next;
+  const char* p;
+  const char* q;
+  char code;
+  int16_t row_w, row_x, cx;
+  int16_t row_y = box.y;
+  bool ellipsis;
+
+  const int16_t dot_w = font.get_symbol_width('.');
+  const int16_t ellipsis_w = 3*dot_w + 2*font.interval;
+
+  // clip rectangle is the box inside of the segment
+  if(clip.x < 0) { clip.w += clip.x; clip.x = 0; }
+  if(clip.y < 0) { clip.h += clip.y; clip.y = 0; }
+  if(clip.x + clip.w > sw) clip.w = sw - clip.x;
+  if(clip.y + clip.h > shp) clip.h = shp - clip.y;
+
+  if(clip.w <= 0 || clip.h <= 0)
+    return bbox;
+
+  fill_area(clip.x, clip.y, clip.w, clip.h, !color_noinv);
+
+  while(*str && row_y < box.y + box.h)
+  {
+    if(str_w >= 0 && (str_w <= box.w || !(flags & TEXT_WRAP)))
+    {
+      for(end = str; *end; end++);                  // the whole string is one row of known width
+      next = end;
+      row_w = str_w;
+    }
+    else
+      row_w = measure_text_row(str, font, box.w, flags & TEXT_WRAP, &end, &next);
+
+    // ellipsis: row is wider than the box, or there is more text but the next row does not fit
+    ellipsis = (flags & TEXT_ELLIPSIS) && (row_w > box.w || (*next && row_y + 2*font.height > box.y + box.h));
+
+    if(ellipsis)
+    {
+      // keep chars which fit together with the ellipsis
+      row_w = 0;
+      for(p = str; p < end; p = q)
+      {
+        q = p;
+        cx = ((p == str) ? 0 : row_w + font.interval) + font.get_symbol_width(font.read_code(&q));
+        if(cx + font.interval + ellipsis_w > box.w)
+          break;
+        row_w = cx;
+      }
+
+      end = p;
+      row_w += (end == str) ? ellipsis_w : font.interval + ellipsis_w;
+    }
+
+    if(align == SSD1306_TEXT_ALIGN::LEFT || row_w >= box.w)
+      row_x = box.x;
+    else if(align == SSD1306_TEXT_ALIGN::CENTER)
+      row_x = box.x + (box.w - row_w) / 2;
+    else
+      row_x = box.x + box.w - row_w;
+
+    cx = row_x;
+    for(p = str; p < end && cx < clip.x + clip.w;)
+    {
+      code = font.read_code(&p);
+      put_glyph(cx, row_y, font.get_glyph(code), font, clip, color_noinv);
+      cx += font.get_symbol_width(code) + font.interval;
+    }
+
+    if(ellipsis)
+      for(uint8_t i = 0; i < 3; i++, cx += dot_w + font.interval)
+        put_glyph(cx, row_y, font.get_glyph('.'), font, clip, color_noinv);
+
+    // bounding box of all rows, clipped by the box
+    int16_t bx = (row_x < clip.x) ? clip.x : row_x;
+    int16_t bxe = (row_x + row_w > clip.x + clip.w) ? clip.x + clip.w : row_x + row_w;
+    int16_t by = (row_y < clip.y) ? clip.y : row_y;
+    int16_t bye = (row_y + font.height > clip.y + clip.h) ? clip.y + clip.h : row_y + font.height;
+
+    if(bx < bxe && by < bye)
+    {
+      if(bbox.w == 0)
+        bbox = DispRect{bx, by, (int16_t)(bxe - bx), (int16_t)(bye - by)};
+      else
+      {
+        int16_t ux = (bx < bbox.x) ? bx : bbox.x;
+        int16_t uxe = (bxe > bbox.x + bbox.w) ? bxe : bbox.x + bbox.w;
+        bbox.w = uxe - ux;
+        bbox.x = ux;
+        bbox.h = bye - bbox.y;
+      }
+    }
+
+    row_y += font.height;
+    str = next;
+  }
+
+  if(upd_mode == SEGMENT_UPDATE_MODE::IMMEDIATELY)
+    update_clipped(clip.x, clip.y, clip.x + clip.w - 1, clip.y + clip.h - 1);
+
+  return bbox;
+}
+
+
+
+
+/**
+ * @brief Write numerical to the specified place in display segment
+ * 
+ * @param x_px                        x coordinate in px
+ * @param y_px                        y coordinate in px
+ * @param num                         num to be displayed
+ * @param font                        font that determines clear height
+ * @param color_noinv                 (optional, def = true) determines color no inversion
+ */
+void DispSegment::write_num(uint8_t x_px, uint8_t y_px, signed num, Font &font, bool color_noinv)
+{
+  write_num(x_px, y_px, num, NumFormat(), font, color_noinv);
+}
+
+
+
+
+/**
+ * @brief Write formatted numerical to the specified place in display segment. Chars are drawn one by one, without intermediate string
+ * 
+ * @param x_px                        x coordinate in px (the last column of the number if format is right aligned)
+ * @param y_px                        y coordinate in px
+ * @param num                         num to be displayed
+ * @param fmt                         number format: decimals, padding, sign, alignment, unit suffix
+ * @param font                        font that determines clear height
+ * @param color_noinv                 (optional, def = true) determines color no inversion
+ */
+void DispSegment::write_num(uint8_t x_px, uint8_t y_px, signed num, const NumFormat &fmt, Font &font, bool color_noinv)
+{
+  uint8_t w;
+
+  if(fmt.align == SSD1306_NUM_ALIGN::RIGHT)
+  {
+    w = get_num_string_size_px(num, fmt, font);
+
+    if(w > x_px + 1)                          // Number does not fit
+      return;
+    
+    x_px = x_px + 1 - w;
+  }
+
+  if(!set_cursor(x_px, y_px))                 // Bad coordinates
+    return;
+
+  write_formatted(NumFormatter(num, fmt), font, color_noinv);
+}
+
+
+
+
+/**
+ * @brief Write fixed-point numerical to the specified place in display segment: num = 1234, decimals = 2 gives "12.34"
+ * 
+ * @param x_px                        x coordinate in px
+ * @param y_px                        y coordinate in px
+ * @param num                         num to be displayed, multiplied by 10^decimals
+ * @param decimals                    digits after decimal point
+ * @param font                        font that determines clear height
+ * @param color_noinv                 (optional, def = true) determines color no inversion
+ */
+void DispSegment::write_fixed(uint8_t x_px, uint8_t y_px, signed num, uint8_t decimals, Font &font, bool color_noinv)
+{
+  write_num(x_px, y_px, num, NumFormat(decimals), font, color_noinv);
+}
+
+
+
+
+/**
+ * @brief Writes chars of formatted number to the current place in display segment.
+ *        Chars which the font has no glyphs for (sign, point and spaces in "font_dig32") are skipped
+ * 
+ * @param nf                          number formatter
+ * @param font                        font that determines clear height
+ * @param color_noinv                 determines color no inversion
+ */
+void DispSegment::write_formatted(NumFormatter nf, Font &font, bool color_noinv)
+{
+  char ch;
+
+  while((ch = nf.next()) != 0)
+  {
+    if(!font.has_glyph(ch))
+      continue;
+
+    if(!write_char(ch, font, color_noinv))
+      return;                                 // Char could not be written
+  }
+}
+
+
+
+
+
+/**
+ * @brief Write numerical with space or minus sign to the specified place in display segment
+ * 
+ * @param x_px                        x coordinate in px
+ * @param y_px                        y coordinate in px
+ * @param num                         num to be displayed
+ * @param font                        font that determines clear height
+ * @param color_noinv                 (optional, def = true) determines color no inversion
+ */
+void DispSegment::write_num_sign(uint8_t x_px, uint8_t y_px, signed num, Font &font, bool color_noinv)
+{
+  write_num(x_px, y_px, num, NumFormat(0, (const char*)0, 0, ' ', SSD1306_NUM_SIGN::SPACE), font, color_noinv);
+}
+
+
+
+
+/**
+ * @brief Write numerical to the specified place in display segment. Shows it IMMEDIATLY
+ * 
+ * @param x_px                        x coordinate in px
+ * @param y_px                        y coordinate in px
+ * @param num                         num to be displayed
+ * @param font                        font that determines clear height
+ * @param color_noinv                 (optional, def = true) determines color no inversion
+ */
+void DispSegment::write_num_now(uint8_t x_px, uint8_t y_px, signed num, Font &font, bool color_noinv)
+{
+  write_num_now(x_px, y_px, num, NumFormat(), font, color_noinv);
+}
+
+
+
+
+/**
+ * @brief Write formatted numerical to the specified place in display segment. Shows it IMMEDIATLY
+ * 
+ * @param x_px                        x coordinate in px (the last column of the number if format is right aligned)
+ * @param y_px                        y coordinate in px
+ * @param num                         num to be displayed
+ * @param fmt                         number format: decimals, padding, sign, alignment, unit suffix
+ * @param font                        font that determines clear height
+ * @param color_noinv                 (optional, def = true) determines color no inversion
+ */
+void DispSegment::write_num_now(uint8_t x_px, uint8_t y_px, signed num, const NumFormat &fmt, Font &font, bool color_noinv)
+{
+  uint8_t w = get_num_string_size_px(num, fmt, font);
+
+  if(fmt.align == SSD1306_NUM_ALIGN::RIGHT)
+  {
+    if(w > x_px + 1)                          // Number does not fit
+      return;
+    
+    x_px = x_px + 1 - w;
+  }
+
+  if(!set_cursor(x_px, y_px))                 // Bad coordinates
+    return;
+
+  write_formatted(NumFormatter(num, fmt), font, color_noinv);
+  update_clipped(x_px, y_px, x_px + w - 1, y_px + font.height - 1);
+}
+
+
+
+
+/**
+ * @brief Clears the specified font by a certain number of pixels horizontally
+ * 
+ * @param x_px                        x coordinate in px
+ * @param y_px                        y coordinate in px
+ * @param sz_px                       amount of pixels to be cleared
+ * @param font                        font that determines clear height
+ * @param color_noinv                 (optional, def = true) determines color no inversion
+ */
+void DispSegment::clear_font_px(uint8_t x_px, uint8_t y_px, uint8_t sz_px, Font &font, bool color_noinv)
+{  
+  if(!set_cursor(x_px, y_px))                      // Bad coordinates
+    return;
+   
+  fill_area(x_px, y_px, sz_px, font.height, !color_noinv);
+}
+
+
+
+
+/**
+ * @brief Clears symbol of the specified font
+ * 
+ * @param x_px                        x coordinate of symbol in px
+ * @param y_px                        y coordinate of symbol in px
+ * @param font                        font that determines clear height
+ * @param color_noinv                 (optional, def = true) determines color no inversion
+ */
+void DispSegment::clear_font_symb(uint8_t x_px, uint8_t y_px, uint8_t sz_symb, Font &font, bool color_noinv){
+  clear_font_px(x_px, y_px, sz_symb*(font.width + font.interval)-font.interval, font, color_noinv);
+}
+
+
+
+
+/**
+ * @brief Clears string row of the specified font
+ * 
+ * @param y_px                        row coordinates in px
+ * @param font                        font that determines clear height
+ * @param color_noinv                 (optional, def = true) determines color no inversion
+ */
+void DispSegment::clear_font_row(uint8_t y_px, Font &font, bool color_noinv){
+  clear_font_px(0, y_px, sw, font, color_noinv);
+}
+
+
+            
+
+/**
+* @brief Returns size of the specified string, written in specified font, in pixels
+* @param[in] str                       string
+* @param[in] font                      font
+*/
+uint8_t DispSegment::get_string_size_px(const char* str, Font &font)
+{
+  return font.get_string_width(str);
+}
+
+
+
+
+
+/**
+* @brief Returns size of the specified number, written in specified font, in pixels
 * @param[in] num                       number
 * @param[in] font                      font
 */
 uint8_t DispSegment::get_num_string_size_px(signed num, Font &font)
 {
-  char sbuf[10];
-  char* sbuf_ptr = sbuf;
-  sprintf(sbuf, "%d", num);
+  return get_num_string_size_px(num, NumFormat(), font);
+}
+
+
+
 
+
+/**
+* @brief Returns size of the specified formatted number, written in specified font, in pixels
+*        (chars which the font has no glyphs for are skipped, as by "write_formatted")
+* @param[in] num                       number
+* @param[in] fmt                       number format
+* @param[in] font                      font
+*/
+uint8_t DispSegment::get_num_string_size_px(signed num, const NumFormat &fmt, Font &font)
+{
+  NumFormatter nf(num, fmt);
   uint8_t size_px = 0;
-  
-  while (*sbuf_ptr) 
-    size_px += font.get_symbol_width(*sbuf_ptr++) + font.interval;
-  
-  return size_px - font.interval;
+  char ch;
+
+  while((ch = nf.next()) != 0)
+    if(font.has_glyph(ch))
+      size_px += font.get_symbol_width(ch) + font.interval;
+
+  return size_px ? size_px - font.interval : 0;
 }
 
 
@@ -552,8 +1325,7 @@ uint8_t DispSegment::get_num_string_size_px(signed num, Font &font)
 */
 void DispSegment::draw_hline(uint8_t x_px, uint8_t y_px, uint8_t w_px, bool color_noinv) 
 {
-  while(w_px--)
-    draw_pixel(x_px++, y_px, color_noinv);
+  fill_area(x_px, y_px, w_px, 1, color_noinv);
 }
 
 
@@ -568,8 +1340,7 @@ void DispSegment::draw_hline(uint8_t x_px, uint8_t y_px, uint8_t w_px, bool colo
 */
 void DispSegment::draw_vline(uint8_t x_px, uint8_t y_px, uint8_t h_px, bool color_noinv) 
 {
-  while(h_px--)
-    draw_pixel(x_px, y_px++, color_noinv);
+  fill_area(x_px, y_px, 1, h_px, color_noinv);
 }
 
 
@@ -646,8 +1417,7 @@ void DispSegment::draw_frame(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h
 */
 void DispSegment::draw_box(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_px, bool color_noinv) 
 {
-  while(h_px--)
-    draw_hline(x_px, y_px++, w_px, color_noinv);
+  fill_area(x_px, y_px, w_px, h_px, color_noinv);
 
   if(upd_mode == SEGMENT_UPDATE_MODE::IMMEDIATELY)
       update_part(x_px, y_px, x_px + w_px - 1, y_px + h_px - 1);
@@ -656,6 +1426,25 @@ void DispSegment::draw_box(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_p
 
 
 
+/**
+* @brief Draws a rectangle filled with pattern (i.e. inactive or disabled area). Coordinates are correspond to left upper corner
+* @param[in] x_px                      x coordinate of the left upper corner in px
+* @param[in] y_px                      y coordinate of the left upper corner in px
+* @param[in] w_px                      width of the rectangle in px
+* @param[in] h_px                      height of the rectangle in px
+* @param[in] pattern                   fill pattern (PATTERN_BAYER25, PATTERN_HATCH, ...)
+*/
+void DispSegment::draw_box(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_px, const FillPattern &pattern)
+{
+  fill_area(x_px, y_px, w_px, h_px, pattern);
+
+  if(upd_mode == SEGMENT_UPDATE_MODE::IMMEDIATELY)
+    update_clipped(x_px, y_px, x_px + w_px - 1, y_px + h_px - 1);
+}
+
+
+
+
 /**
 * @brief Draws circle. Coordinates are center of the circle. Pixel positions calculated using Bresenham's algorithm 
 * @param[in] x_px                      x coordinate of the center in px
@@ -694,7 +1483,7 @@ void DispSegment::draw_circle(uint8_t x_px, uint8_t y_px, uint8_t r_px, bool col
     } while (x <= 0);
 
     if(upd_mode == SEGMENT_UPDATE_MODE::IMMEDIATELY)
-      update_part(x_px - r_px, y_px - r_px, x_px + r_px, y_px + r_px);
+      update_clipped(x_px - r_px, y_px - r_px, x_px + r_px, y_px + r_px);
 }
 
 
@@ -702,26 +1491,45 @@ void DispSegment::draw_circle(uint8_t x_px, uint8_t y_px, uint8_t r_px, bool col
 
 /**
 * @brief Draws filled circle. Coordinates are center of the circle. Pixel positions calculated using Bresenham's algorithm 
+*        The circle is filled by vertical spans: one page-masked span per column
 * @param[in] x_px                      x coordinate of the center in px
 * @param[in] y_px                      y coordinate of the center in px
 * @param[in] r_px                      radius in px
 * @param[in] color_noinv               (optional, def = true) determines color no inversion
 */
 void DispSegment::draw_filled_circle(uint8_t x_px, uint8_t y_px, uint8_t r_px, bool color_noinv) {
+    draw_filled_circle(x_px, y_px, r_px, color_noinv ? PATTERN_SOLID : PATTERN_EMPTY);
+}
+
+
+
+
+/**
+* @brief Draws circle filled with pattern. Coordinates are center of the circle. Pixel positions calculated using Bresenham's algorithm 
+*        The circle is filled by vertical spans: one page-masked span per column
+* @param[in] x_px                      x coordinate of the center in px
+* @param[in] y_px                      y coordinate of the center in px
+* @param[in] r_px                      radius in px
+* @param[in] pattern                   fill pattern (PATTERN_SOLID, PATTERN_BAYER50, PATTERN_HATCH, ...)
+*/
+void DispSegment::draw_filled_circle(uint8_t x_px, uint8_t y_px, uint8_t r_px, const FillPattern &pattern) {
     int32_t x = -r_px;
     int32_t y = 0;
     int32_t err = 2 - 2 * r_px;
     int32_t e2;
 
+    int32_t span_x = x;                     // column offset of the current span
+    int32_t span_y = 0;                     // half height of the current span
+
     if (x_px >= sw || y_px >= shp) 
         return;
 
     do {
-        for (uint8_t _y = (y_px + y); _y >= (y_px - y); _y--) {
-            for (uint8_t _x = (x_px - x); _x >= (x_px + x); _x--) {
-                draw_pixel(_x, _y, color_noinv);
-            }
+        if (x != span_x) {
+            fill_symmetric_spans(x_px, x_px, y_px, y_px, -span_x, span_y, pattern);
+            span_x = x;
         }
+        span_y = y;
 
         e2 = err;
         if (e2 <= y) {
@@ -738,8 +1546,367 @@ void DispSegment::draw_filled_circle(uint8_t x_px, uint8_t y_px, uint8_t r_px, b
         }
     } while (x <= 0);
 
+    fill_symmetric_spans(x_px, x_px, y_px, y_px, -span_x, span_y, pattern);
+
+    if(upd_mode == SEGMENT_UPDATE_MODE::IMMEDIATELY)
+      update_clipped(x_px - r_px, y_px - r_px, x_px + r_px, y_px + r_px);
+}
+
+
+
+
+/**
+* @brief Draws ellipse. Coordinates are center of the ellipse. Pixel positions calculated using Bresenham's (midpoint) algorithm 
+* @param[in] x_px                      x coordinate of the center in px
+* @param[in] y_px                      y coordinate of the center in px
+* @param[in] rx_px                     horizontal radius in px
+* @param[in] ry_px                     vertical radius in px
+* @param[in] color_noinv               (optional, def = true) determines color no inversion
+*/
+void DispSegment::draw_ellipse(uint8_t x_px, uint8_t y_px, uint8_t rx_px, uint8_t ry_px, bool color_noinv) {
+    int32_t x = -rx_px;
+    int32_t y = 0;
+    int32_t a2 = (int32_t)rx_px * rx_px;
+    int32_t b2 = (int32_t)ry_px * ry_px;
+    int32_t err = x * (2 * b2 + x) + b2;
+    int32_t e2;
+
+    if (x_px >= sw || y_px >= shp) 
+        return;
+
+    do {
+        plot_pixel(x_px - x, y_px + y, color_noinv);
+        plot_pixel(x_px + x, y_px + y, color_noinv);
+        plot_pixel(x_px + x, y_px - y, color_noinv);
+        plot_pixel(x_px - x, y_px - y, color_noinv);
+
+        e2 = 2 * err;
+        if (e2 >= (x * 2 + 1) * b2) {
+            x++;
+            err += (x * 2 + 1) * b2;
+        }
+        if (e2 <= (y * 2 + 1) * a2) {
+            y++;
+            err += (y * 2 + 1) * a2;
+        }
+    } while (x <= 0);
+
+    while (y++ < ry_px) {                   // finish tips of the flat ellipses
+        plot_pixel(x_px, y_px + y, color_noinv);
+        plot_pixel(x_px, y_px - y, color_noinv);
+    }
+
+    if(upd_mode == SEGMENT_UPDATE_MODE::IMMEDIATELY)
+      update_clipped(x_px - rx_px, y_px - ry_px, x_px + rx_px, y_px + ry_px);
+}
+
+
+
+
+/**
+* @brief Draws filled ellipse. Coordinates are center of the ellipse. The ellipse is filled by vertical spans: one page-masked span per column
+* @param[in] x_px                      x coordinate of the center in px
+* @param[in] y_px                      y coordinate of the center in px
+* @param[in] rx_px                     horizontal radius in px
+* @param[in] ry_px                     vertical radius in px
+* @param[in] color_noinv               (optional, def = true) determines color no inversion
+*/
+void DispSegment::draw_filled_ellipse(uint8_t x_px, uint8_t y_px, uint8_t rx_px, uint8_t ry_px, bool color_noinv) {
+    draw_filled_ellipse(x_px, y_px, rx_px, ry_px, color_noinv ? PATTERN_SOLID : PATTERN_EMPTY);
+}
+
+
+
+
+/**
+* @brief Draws ellipse filled with pattern. Coordinates are center of the ellipse. The ellipse is filled by vertical spans: one page-masked span per column
+* @param[in] x_px                      x coordinate of the center in px
+* @param[in] y_px                      y coordinate of the center in px
+* @param[in] rx_px                     horizontal radius in px
+* @param[in] ry_px                     vertical radius in px
+* @param[in] pattern                   fill pattern (PATTERN_SOLID, PATTERN_BAYER50, PATTERN_HATCH, ...)
+*/
+void DispSegment::draw_filled_ellipse(uint8_t x_px, uint8_t y_px, uint8_t rx_px, uint8_t ry_px, const FillPattern &pattern) {
+    int32_t x = -rx_px;
+    int32_t y = 0;
+    int32_t a2 = (int32_t)rx_px * rx_px;
+    int32_t b2 = (int32_t)ry_px * ry_px;
+    int32_t err = x * (2 * b2 + x) + b2;
+    int32_t e2;
+
+    int32_t span_x = x;
+    int32_t span_y = 0;
+
+    if (x_px >= sw || y_px >= shp) 
+        return;
+
+    do {
+        if (x != span_x) {
+            fill_symmetric_spans(x_px, x_px, y_px, y_px, -span_x, span_y, pattern);
+            span_x = x;
+        }
+        span_y = y;
+
+        e2 = 2 * err;
+        if (e2 >= (x * 2 + 1) * b2) {
+            x++;
+            err += (x * 2 + 1) * b2;
+        }
+        if (e2 <= (y * 2 + 1) * a2) {
+            y++;
+            err += (y * 2 + 1) * a2;
+        }
+    } while (x <= 0);
+
+    if (span_y < ry_px)                     // tips of the flat ellipses
+        span_y = ry_px;
+
+    fill_symmetric_spans(x_px, x_px, y_px, y_px, -span_x, span_y, pattern);
+
+    if(upd_mode == SEGMENT_UPDATE_MODE::IMMEDIATELY)
+      update_clipped(x_px - rx_px, y_px - ry_px, x_px + rx_px, y_px + ry_px);
+}
+
+
+
+
+/**
+* @brief Draws circle arc. Coordinates are center of the circle. Angles are counted counterclockwise, 0 corresponds to 3 o'clock
+* @param[in] x_px                      x coordinate of the center in px
+* @param[in] y_px                      y coordinate of the center in px
+* @param[in] r_px                      radius in px
+* @param[in] start_deg                 start angle of the arc in degrees
+* @param[in] end_deg                   end angle of the arc in degrees (arc is drawn counterclockwise from start to end)
+* @param[in] color_noinv               (optional, def = true) determines color no inversion
+*/
+void DispSegment::draw_arc(uint8_t x_px, uint8_t y_px, uint8_t r_px, uint16_t start_deg, uint16_t end_deg, bool color_noinv) {
+    int32_t x = -r_px;
+    int32_t y = 0;
+    int32_t err = 2 - 2 * r_px;
+    int32_t e2;
+
+    // direction vectors of the arc ends (y axis looks up)
+    int32_t sx = cos_deg(start_deg), sy = sin_deg(start_deg);
+    int32_t ex = cos_deg(end_deg),   ey = sin_deg(end_deg);
+
+    uint16_t sweep = (end_deg % 360 + 360 - start_deg % 360) % 360;
+    if (sweep == 0 && end_deg != start_deg)
+        sweep = 360;
+
+    if (x_px >= sw || y_px >= shp) 
+        return;
+
+    do {
+        const int32_t px[4] = {-x, x, x, -x};
+        const int32_t py[4] = {y, y, -y, -y};
+
+        for (uint8_t q = 0; q < 4; q++) {
+            int32_t s_cross = sx * (-py[q]) - sy * px[q];           // start x point
+            int32_t e_cross = px[q] * ey - (-py[q]) * ex;           // point x end
+            bool inside;
+
+            if (sweep >= 360)
+                inside = true;
+            else if (sweep <= 180)
+                inside = (s_cross >= 0) && (e_cross >= 0);
+            else
+                inside = (s_cross >= 0) || (e_cross >= 0);
+
+            if (inside)
+                plot_pixel(x_px + px[q], y_px + py[q], color_noinv);
+        }
+
+        e2 = err;
+        if (e2 <= y) {
+            y++;
+            err = err + (y * 2 + 1);
+            if(-x == y && e2 <= x) {
+                e2 = 0;
+            }
+        }
+
+        if (e2 > x) {
+            x++;
+            err = err + (x * 2 + 1);
+        }
+    } while (x <= 0);
+
+    if(upd_mode == SEGMENT_UPDATE_MODE::IMMEDIATELY)
+      update_clipped(x_px - r_px, y_px - r_px, x_px + r_px, y_px + r_px);
+}
+
+
+
+
+/**
+* @brief Draws a rectangle with rounded corners. Coordinates are correspond to left upper corner
+* @param[in] x_px                      x coordinate of the left upper corner in px
+* @param[in] y_px                      y coordinate of the left upper corner in px
+* @param[in] w_px                      width of the rectangle in px
+* @param[in] h_px                      height of the rectangle in px
+* @param[in] r_px                      radius of the corners in px
+* @param[in] color_noinv               (optional, def = true) determines color no inversion
+*/
+void DispSegment::draw_rounded_frame(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_px, uint8_t r_px, bool color_noinv) {
+    if (w_px == 0 || h_px == 0)
+        return;
+
+    if (r_px > (w_px - 1) / 2) r_px = (w_px - 1) / 2;
+    if (r_px > (h_px - 1) / 2) r_px = (h_px - 1) / 2;
+
+    // corner centers
+    int16_t xl = x_px + r_px, xr = x_px + w_px - 1 - r_px;
+    int16_t yt = y_px + r_px, yb = y_px + h_px - 1 - r_px;
+
+    fill_area(xl, y_px, xr - xl + 1, 1, color_noinv);
+    fill_area(xl, y_px + h_px - 1, xr - xl + 1, 1, color_noinv);
+    fill_area(x_px, yt, 1, yb - yt + 1, color_noinv);
+    fill_area(x_px + w_px - 1, yt, 1, yb - yt + 1, color_noinv);
+
+    int32_t x = -r_px;
+    int32_t y = 0;
+    int32_t err = 2 - 2 * r_px;
+    int32_t e2;
+
+    do {
+        plot_pixel(xr - x, yb + y, color_noinv);
+        plot_pixel(xl + x, yb + y, color_noinv);
+        plot_pixel(xl + x, yt - y, color_noinv);
+        plot_pixel(xr - x, yt - y, color_noinv);
+
+        e2 = err;
+        if (e2 <= y) {
+            y++;
+            err = err + (y * 2 + 1);
+            if(-x == y && e2 <= x) {
+                e2 = 0;
+            }
+        }
+
+        if (e2 > x) {
+            x++;
+            err = err + (x * 2 + 1);
+        }
+    } while (x <= 0);
+
+    if(upd_mode == SEGMENT_UPDATE_MODE::IMMEDIATELY)
+      update_clipped(x_px, y_px, x_px + w_px - 1, y_px + h_px - 1);
+}
+
+
+
+
+/**
+* @brief Draws a filled rectangle with rounded corners. Coordinates are correspond to left upper corner
+*        The middle part is filled by one "fill_area" call, the corners - by vertical spans
+* @param[in] x_px                      x coordinate of the left upper corner in px
+* @param[in] y_px                      y coordinate of the left upper corner in px
+* @param[in] w_px                      width of the rectangle in px
+* @param[in] h_px                      height of the rectangle in px
+* @param[in] r_px                      radius of the corners in px
+* @param[in] color_noinv               (optional, def = true) determines color no inversion
+*/
+void DispSegment::draw_rounded_box(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_px, uint8_t r_px, bool color_noinv) {
+    draw_rounded_box(x_px, y_px, w_px, h_px, r_px, color_noinv ? PATTERN_SOLID : PATTERN_EMPTY);
+}
+
+
+
+
+/**
+* @brief Draws a rectangle with rounded corners filled with pattern. Coordinates are correspond to left upper corner
+*        The middle part is filled by one "fill_area" call, the corners - by vertical spans
+* @param[in] x_px                      x coordinate of the left upper corner in px
+* @param[in] y_px                      y coordinate of the left upper corner in px
+* @param[in] w_px                      width of the rectangle in px
+* @param[in] h_px                      height of the rectangle in px
+* @param[in] r_px                      radius of the corners in px
+* @param[in] pattern                   fill pattern (PATTERN_SOLID, PATTERN_BAYER50, PATTERN_HATCH, ...)
+*/
+void DispSegment::draw_rounded_box(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_px, uint8_t r_px, const FillPattern &pattern) {
+    if (w_px == 0 || h_px == 0)
+        return;
+
+    if (r_px > (w_px - 1) / 2) r_px = (w_px - 1) / 2;
+    if (r_px > (h_px - 1) / 2) r_px = (h_px - 1) / 2;
+
+    // corner centers
+    int16_t xl = x_px + r_px, xr = x_px + w_px - 1 - r_px;
+    int16_t yt = y_px + r_px, yb = y_px + h_px - 1 - r_px;
+
+    fill_area(xl + 1, y_px, xr - xl - 1, h_px, pattern);
+
+    int32_t x = -r_px;
+    int32_t y = 0;
+    int32_t err = 2 - 2 * r_px;
+    int32_t e2;
+
+    int32_t span_x = x;
+    int32_t span_y = 0;
+
+    do {
+        if (x != span_x) {
+            fill_symmetric_spans(xl, xr, yt, yb, -span_x, span_y, pattern);
+            span_x = x;
+        }
+        span_y = y;
+
+        e2 = err;
+        if (e2 <= y) {
+            y++;
+            err = err + (y * 2 + 1);
+            if(-x == y && e2 <= x) {
+                e2 = 0;
+            }
+        }
+
+        if (e2 > x) {
+            x++;
+            err = err + (x * 2 + 1);
+        }
+    } while (x <= 0);
+
+    fill_symmetric_spans(xl, xr, yt, yb, -span_x, span_y, pattern);
+
     if(upd_mode == SEGMENT_UPDATE_MODE::IMMEDIATELY)
-      update_part(x_px - r_px, y_px - r_px, x_px + r_px, y_px + r_px);
+      update_clipped(x_px, y_px, x_px + w_px - 1, y_px + h_px - 1);
+}
+
+
+
+
+/**
+* @brief Fills two vertical spans placed symmetrically around the centers. Used by filled round shapes.
+*        Spans are at columns (xl - dx) and (xr + dx) and cover rows [yt - dy .. yb + dy]
+* @param[in] xl, xr                    left and right centers x coordinates in px
+* @param[in] yt, yb                    top and bottom centers y coordinates in px
+* @param[in] dx                        horizontal offset of the spans from centers in px
+* @param[in] dy                        vertical offset of the spans ends from centers in px
+* @param[in] pattern                   fill pattern
+*/
+void DispSegment::fill_symmetric_spans(int16_t xl, int16_t xr, int16_t yt, int16_t yb, int16_t dx, int16_t dy, const FillPattern &pattern)
+{
+  fill_area(xl - dx, yt - dy, 1, yb - yt + 2*dy + 1, pattern);
+
+  if(xr + dx != xl - dx)
+    fill_area(xr + dx, yt - dy, 1, yb - yt + 2*dy + 1, pattern);
+}
+
+
+
+
+/**
+* @brief Draws one pixel of the shape outline. Coordinates may be outside of the segment (negative too), such pixels are skipped
+* @param[in] x_px                      x coordinate in px
+* @param[in] y_px                      y coordinate in px
+* @param[in] color_noinv               determines color no inversion
+*/
+void DispSegment::plot_pixel(int16_t x_px, int16_t y_px, bool color_noinv)
+{
+  if(x_px < 0 || y_px < 0 || x_px >= sw || y_px >= shp)
+    return;
+
+  draw_pixel(x_px, y_px, color_noinv);
 }
 
 
@@ -754,25 +1921,113 @@ void DispSegment::draw_filled_circle(uint8_t x_px, uint8_t y_px, uint8_t r_px, b
 * @param[in] selected                 (optional, def = false) determines if this row is selected (highlighted with a sign or color)
 */
 void DispSegment::draw_param(uint8_t y_px, const char* str, Font &font, signed  p_val, bool selected){
-  char sbuf[10];
-  sprintf(sbuf, "%d", p_val);
+  draw_param(y_px, str, font, p_val, NumFormat(), selected);
+}
+
+
+
+
+/**
+* @brief Draws fixed-point numeric parameter, for example: "voltage: 3.30". Start is always at the beginning of the segment
+* @param[in] y_px                     y coordinate in px
+* @param[in] str                      parameter name 
+* @param[in] font                     font that determines checkbox height
+* @param[in] p_val                    parameter numeric value, multiplied by 10^decimals 
+* @param[in] decimals                 digits after decimal point
+* @param[in] selected                 (optional, def = false) determines if this row is selected (highlighted with a sign or color)
+*/
+void DispSegment::draw_param_fixed(uint8_t y_px, const char* str, Font &font, signed p_val, uint8_t decimals, bool selected){
+  draw_param(y_px, str, font, p_val, NumFormat(decimals), selected);
+}
+
+
+
+
+/**
+* @brief Draws formatted numeric parameter, for example: "speed: 90 km/h". Start is always at the beginning of the segment
+*        The value is always right aligned to the end of the segment
+* @param[in] y_px                     y coordinate in px
+* @param[in] str                      parameter name 
+* @param[in] font                     font that determines checkbox height
+* @param[in] p_val                    parameter numeric value 
+* @param[in] fmt                      value format: decimals, padding, sign, unit suffix
+* @param[in] selected                 (optional, def = false) determines if this row is selected (highlighted with a sign or color)
+*/
+void DispSegment::draw_param(uint8_t y_px, const char* str, Font &font, signed p_val, const NumFormat &fmt, bool selected){
+  draw_param_row(y_px, str, (const StaticLabel*)0, font, p_val, fmt, selected);
+}
+
+
+
+
+/**
+* @brief Draws numeric parameter with static label, for example: "speed: 90". Start is always at the beginning of the segment
+* @param[in] y_px                     y coordinate in px
+* @param[in] label                    parameter name, rasterized at compile time with "font"
+* @param[in] font                     font that determines checkbox height
+* @param[in] p_val                    parameter numeric value 
+* @param[in] selected                 (optional, def = false) determines if this row is selected (highlighted with a sign or color)
+*/
+void DispSegment::draw_param(uint8_t y_px, const StaticLabel &label, Font &font, signed p_val, bool selected){
+  draw_param_row(y_px, (const char*)0, &label, font, p_val, NumFormat(), selected);
+}
+
+
+
+
+/**
+* @brief Draws formatted numeric parameter with static label, for example: "speed: 90 km/h". See "draw_param" above
+* @param[in] y_px                     y coordinate in px
+* @param[in] label                    parameter name, rasterized at compile time with "font"
+* @param[in] font                     font that determines checkbox height
+* @param[in] p_val                    parameter numeric value 
+* @param[in] fmt                      value format: decimals, padding, sign, unit suffix
+* @param[in] selected                 (optional, def = false) determines if this row is selected (highlighted with a sign or color)
+*/
+void DispSegment::draw_param(uint8_t y_px, const StaticLabel &label, Font &font, signed p_val, const NumFormat &fmt, bool selected){
+  draw_param_row(y_px, (const char*)0, &label, font, p_val, fmt, selected);
+}
+
+
+
+
+/**
+* @brief Draws parameter name: string or static label (one of them is null)
+*/
+void DispSegment::write_title(uint8_t x_px, uint8_t y_px, const char* str, const StaticLabel* label, Font &font, bool color_noinv)
+{
+  if(label)
+    write_label(x_px, y_px, *label, color_noinv);
+  else
+    write_string(x_px, y_px, str, font, color_noinv);
+}
+
+
+
+
+/**
+* @brief Draws formatted numeric parameter row, its name is string or static label (see "draw_param")
+*/
+void DispSegment::draw_param_row(uint8_t y_px, const char* str, const StaticLabel* label, Font &font, signed p_val, const NumFormat &fmt, bool selected){
+  uint8_t val_w = get_num_string_size_px(p_val, fmt, font);
 
   if(select_method == SSD1306_ITEM_SELECT_METHOD::ARROW)
   {
     clear_font_px(0, y_px, sw, font, SSD1306_COLOR_NON_INV);
     if(selected) 
       write_string(0, y_px, ">", font, SSD1306_COLOR_NON_INV);
-    write_string(font.width+font.interval, y_px, str, font, SSD1306_COLOR_NON_INV);
+    write_title(font.width+font.interval, y_px, str, label, font, SSD1306_COLOR_NON_INV);
 
     selected = SSD1306_COLOR_NON_INV;
   }
   else
   {
     clear_font_px(0, y_px, sw, font, selected);
-    write_string(1, y_px, str, font, selected);
+    write_title(1, y_px, str, label, font, selected);
   }
 
-  write_string(sw - get_string_size_px(sbuf, font) - 1, y_px, sbuf, font, selected);
+  if(set_cursor(sw - val_w - 1, y_px))
+    write_formatted(NumFormatter(p_val, fmt), font, selected);
 
   if(upd_mode == SEGMENT_UPDATE_MODE::IMMEDIATELY)
     update_row(y_px, font);
@@ -791,20 +2046,66 @@ void DispSegment::draw_param(uint8_t y_px, const char* str, Font &font, signed
 */
 void DispSegment::draw_param(uint8_t y_px, const char* str, Font &font, const char* p_str, bool selected)
 {  
+  draw_param(y_px, str, MeasuredString(p_str, font), selected);
+}
+
+
+
+
+/**
+* @brief Draws string parameter with measured value, for example: "show speed: off". Start is always at the beginning of the segment
+*        Value width is not recomputed, use it for menus which are redrawn often
+* @param[in] y_px                     y coordinate in px
+* @param[in] str                      parameter name (show speed:)
+* @param[in] p_mstr                   measured parameter string value (off), its font determines row height
+* @param[in] selected                 (optional, def = false) determines if this row is selected (highlighted with a sign or color)
+*/
+void DispSegment::draw_param(uint8_t y_px, const char* str, const MeasuredString &p_mstr, bool selected)
+{  
+  draw_param_row(y_px, str, (const StaticLabel*)0, p_mstr, selected);
+}
+
+
+
+
+/**
+* @brief Draws string parameter with static label and measured value, for example: "show speed: off". 
+*        The fastest way to redraw menu rows: the name is one blit and the value is not measured
+* @param[in] y_px                     y coordinate in px
+* @param[in] label                    parameter name, rasterized at compile time with the value font
+* @param[in] p_mstr                   measured parameter string value (off), its font determines row height
+* @param[in] selected                 (optional, def = false) determines if this row is selected (highlighted with a sign or color)
+*/
+void DispSegment::draw_param(uint8_t y_px, const StaticLabel &label, const MeasuredString &p_mstr, bool selected)
+{  
+  draw_param_row(y_px, (const char*)0, &label, p_mstr, selected);
+}
+
+
+
+
+/**
+* @brief Draws string parameter row with measured value, its name is string or static label (see "draw_param")
+*/
+void DispSegment::draw_param_row(uint8_t y_px, const char* str, const StaticLabel* label, const MeasuredString &p_mstr, bool selected)
+{  
+  Font &font = p_mstr.font;
+  const char* p_str = p_mstr.str;
+
   if(select_method == SSD1306_ITEM_SELECT_METHOD::ARROW)
   {
     clear_font_px(0, y_px, sw, font, SSD1306_COLOR_NON_INV);
     if(selected)
       write_string(0, y_px, ">", font, SSD1306_COLOR_NON_INV);
-    write_string(font.width+font.interval, y_px, str, font, SSD1306_COLOR_NON_INV);
-    write_string(sw - get_string_size_px(p_str, font), y_px, p_str, font, SSD1306_COLOR_NON_INV);
+    write_title(font.width+font.interval, y_px, str, label, font, SSD1306_COLOR_NON_INV);
+    write_string(sw - p_mstr.width_px, y_px, p_str, font, SSD1306_COLOR_NON_INV);
   }
   else
   {
     clear_font_px(0, y_px, sw, font, !selected);
 
-    write_string(1, y_px, str, font, !selected);
-    write_string(sw - get_string_size_px(p_str, font) - 1, y_px, p_str, font, !selected);
+    write_title(1, y_px, str, label, font, !selected);
+    write_string(sw - p_mstr.width_px - 1, y_px, p_str, font, !selected);
   }
 
   if(upd_mode == SEGMENT_UPDATE_MODE::IMMEDIATELY)
@@ -815,14 +2116,41 @@ void DispSegment::draw_param(uint8_t y_px, const char* str, Font &font, const ch
 
 
 /**
-* @brief Draws checkbox. Start is always at the beginning of the segment
-* @param[in] y_px                     y coordinate in px
-* @param[in] str                      checkbox title
-* @param[in] font                     font that determines checkbox height
-* @param[in] checked                  (optional, def = false) state of checkbox
-* @param[in] selected                 (optional, def = false) determines if this row is selected (highlighted with a sign or color)
+* @brief Draws checkbox. Start is always at the beginning of the segment
+* @param[in] y_px                     y coordinate in px
+* @param[in] str                      checkbox title
+* @param[in] font                     font that determines checkbox height
+* @param[in] checked                  (optional, def = false) state of checkbox
+* @param[in] selected                 (optional, def = false) determines if this row is selected (highlighted with a sign or color)
+*/
+void DispSegment::draw_checkbox(uint8_t y_px, const  char* str, Font &font, bool checked, bool selected)
+{
+  draw_checkbox_row(y_px, str, (const StaticLabel*)0, font, checked, selected);
+}
+
+
+
+
+/**
+* @brief Draws checkbox with static label. Start is always at the beginning of the segment
+* @param[in] y_px                     y coordinate in px
+* @param[in] label                    checkbox title, rasterized at compile time with "font"
+* @param[in] font                     font that determines checkbox height
+* @param[in] checked                  (optional, def = false) state of checkbox
+* @param[in] selected                 (optional, def = false) determines if this row is selected (highlighted with a sign or color)
+*/
+void DispSegment::draw_checkbox(uint8_t y_px, const StaticLabel &label, Font &font, bool checked, bool selected)
+{
+  draw_checkbox_row(y_px, (const char*)0, &label, font, checked, selected);
+}
+
+
+
+
+/**
+* @brief Draws checkbox row, its title is string or static label (see "draw_checkbox")
 */
-void DispSegment::draw_checkbox(uint8_t y_px, const  char* str, Font &font, bool checked, bool selected)
+void DispSegment::draw_checkbox_row(uint8_t y_px, const char* str, const StaticLabel* label, Font &font, bool checked, bool selected)
 {
   uint8_t color_noinv = select_method == SSD1306_ITEM_SELECT_METHOD::ARROW ? true : !selected;
 
@@ -831,12 +2159,12 @@ void DispSegment::draw_checkbox(uint8_t y_px, const  char* str, Font &font, bool
     clear_font_px(0, y_px, sw, font, SSD1306_COLOR_NON_INV);
     if(selected)
       write_string(0, y_px, ">", font, SSD1306_COLOR_NON_INV);
-    write_string(font.width+font.interval, y_px, str, font, SSD1306_COLOR_NON_INV);
+    write_title(font.width+font.interval, y_px, str, label, font, SSD1306_COLOR_NON_INV);
   }
   else
   {
     clear_font_row(y_px, font, !selected);
-    write_string(1, y_px, str, font, !selected);
+    write_title(1, y_px, str, label, font, !selected);
   }
  
   if(font.height == font8.height)
@@ -970,8 +2298,8 @@ void DispSegment::draw_x_tick_labels(uint8_t x_px, uint8_t y_px, uint8_t qnt, ui
 */
 void DispSegment::draw_accum(uint8_t x_px, uint8_t y_px, uint8_t charge)
 {
-  if(charge < 5)
-    draw_bitmap(x_px, y_px, accum[charge]);
+  if(charge < accum_sheet.get_cells_num())
+    draw_bitmap(x_px, y_px, accum_sheet, charge);
 }
 
 
@@ -985,37 +2313,448 @@ void DispSegment::draw_accum(uint8_t x_px, uint8_t y_px, uint8_t charge)
 */
 void DispSegment::draw_bitmap(uint8_t x_px, uint8_t y_px, Bitmap &bitmap)
 {
-  unsigned idx = 0;
- 
-  for(uint8_t dy = 0; dy < bitmap.h; dy++)
+  blit(BlitSource(bitmap), x_px, y_px, SSD1306_ROP::COPY);
+
+  if(upd_mode == SEGMENT_UPDATE_MODE::IMMEDIATELY)
+    update_clipped(x_px, y_px, x_px + (bitmap.w-1), y_px + (bitmap.h-1));
+}
+
+
+
+
+/**
+* @brief Draws rectangular part of the bitmap (i.e. icon of the icon sheet). The part is clipped by bitmap and segment borders.
+*        Page-major part which starts at the page border and is drawn at the page border is copied by whole bytes
+* @param[in] x_px                        x coordinate of the destination left upper corner in px, may be negative
+* @param[in] y_px                        y coordinate of the destination left upper corner in px, may be negative
+* @param[in] bitmap                      Bitmap object
+* @param[in] src_rect                    part of the bitmap to draw (px)
+*/
+void DispSegment::draw_bitmap(int16_t x_px, int16_t y_px, const Bitmap &bitmap, DispRect src_rect)
+{
+  blit(BlitSource(bitmap), src_rect, x_px, y_px, SSD1306_ROP::COPY);
+
+  // the same clipping by bitmap borders as in "blit"
+  if(src_rect.x < 0) {x_px -= src_rect.x; src_rect.w += src_rect.x; src_rect.x = 0;}
+  if(src_rect.y < 0) {y_px -= src_rect.y; src_rect.h += src_rect.y; src_rect.y = 0;}
+  if(src_rect.x + src_rect.w > bitmap.w) src_rect.w = bitmap.w - src_rect.x;
+  if(src_rect.y + src_rect.h > bitmap.h) src_rect.h = bitmap.h - src_rect.y;
+
+  if(upd_mode == SEGMENT_UPDATE_MODE::IMMEDIATELY && src_rect.w > 0 && src_rect.h > 0)
+    update_clipped(x_px, y_px, x_px + (src_rect.w-1), y_px + (src_rect.h-1));
+}
+
+
+
+
+/**
+* @brief Draws a cell of the bitmap sheet. See "draw_bitmap" with source rectangle above
+* @param[in] x_px                        x coordinate of the destination left upper corner in px, may be negative
+* @param[in] y_px                        y coordinate of the destination left upper corner in px, may be negative
+* @param[in] sheet                       BitmapSheet object
+* @param[in] index                       cell index (cells are numbered row by row)
+*/
+void DispSegment::draw_bitmap(int16_t x_px, int16_t y_px, const BitmapSheet &sheet, uint16_t index)
+{
+  if(index >= sheet.get_cells_num())
+    return;
+
+  draw_bitmap(x_px, y_px, sheet.bitmap, DispRect{sheet.get_cell_x(index), sheet.get_cell_y(index), sheet.cell_w, sheet.cell_h});
+}
+
+
+
+
+/**
+* @brief Draws a mirrored bitmap. Every visible column is assembled from source page bytes and written by "put_column":
+*        horizontal flip reverses column order, vertical flip reverses page order and bit order of every page byte
+* @param[in] x_px                        x coordinate of the left upper corner in px, may be negative
+* @param[in] y_px                        y coordinate of the left upper corner in px, may be negative
+* @param[in] bitmap                      Bitmap object
+* @param[in] flip                        SSD1306_BITMAP_FLIP:: [FLIP_NONE, FLIP_H, FLIP_V], may be combined: FLIP_H | FLIP_V
+*/
+void DispSegment::draw_bitmap_flipped(int16_t x_px, int16_t y_px, const Bitmap &bitmap, uint8_t flip)
+{
+  BlitSource src(bitmap);
+  int16_t c0 = (x_px < 0) ? -x_px : 0;
+  int16_t c1 = (x_px + bitmap.w > sw) ? sw - x_px : bitmap.w;
+  int16_t r0 = (y_px < 0) ? -y_px : 0;
+  int16_t r1 = (y_px + bitmap.h > shp) ? shp - y_px : bitmap.h;
+
+  if(flip == FLIP_NONE)
+  {
+    blit(src, x_px, y_px, SSD1306_ROP::COPY);
+  }
+  else
   {
-    for(uint8_t dx = 0; dx < (bitmap.w >> 3); dx++)
+    // visible rows are written by bands of 64 (rotated segment may be 128 px high)
+    for(int16_t band = r0; band < r1; band += 64)
     {
-      for(uint8_t b=0; b<8; b++)
-        draw_pixel(x_px + (dx << 3) + b, y_px + dy, bitmap.data[idx]>>(7-b) & 0x01);
-      idx++;
+      int16_t band_end = (r1 - band > 64) ? band + 64 : r1;
+
+      for(int16_t c = c0; c < c1; c++)
+      {
+        uint8_t sc = (flip & FLIP_H) ? bitmap.w - 1 - c : c;
+        uint64_t bits = 0;
+
+        for(int16_t r = band, q = 0; r < band_end; r += 8, q++)
+        {
+          uint8_t byte = (flip & FLIP_V) ? reverse_bits8(src.get_page_byte(sc, bitmap.h - 8 - r)) : src.get_page_byte(sc, r);
+          bits |= (uint64_t)byte << (8*q);
+        }
+
+        put_column(x_px + c, y_px + band, bits, band_end - band, true);
+      }
     }
+  }
+
+  if(upd_mode == SEGMENT_UPDATE_MODE::IMMEDIATELY)
+    update_clipped(x_px, y_px, x_px + (bitmap.w-1), y_px + (bitmap.h-1));
+}
+
+
+
+
+/**
+* @brief Draws a bitmap scaled to the destination size (nearest neighbour, integer and fractional factors), optionally mirrored.
+*        Source column and row of every visible destination column and row are precomputed into index tables,
+*        neighbouring destination columns which take the same source column are not assembled again
+* @param[in] x_px                        x coordinate of the left upper corner in px, may be negative
+* @param[in] y_px                        y coordinate of the left upper corner in px, may be negative
+* @param[in] bitmap                      Bitmap object
+* @param[in] w_px                        destination width in px
+* @param[in] h_px                        destination height in px
+* @param[in] flip                        (optional, def = FLIP_NONE) SSD1306_BITMAP_FLIP:: [FLIP_NONE, FLIP_H, FLIP_V], may be combined
+*/
+void DispSegment::draw_bitmap_scaled(int16_t x_px, int16_t y_px, const Bitmap &bitmap, uint8_t w_px, uint8_t h_px, uint8_t flip)
+{
+  BlitSource src(bitmap);
+  uint8_t col_map[128];                                                 // source column of every visible destination column
+  uint8_t row_map[128];                                                 // source row of every visible destination row
+  uint8_t col_pages[32];                                                // source column in page bytes
+  int16_t c0 = (x_px < 0) ? -x_px : 0;
+  int16_t c1 = (x_px + w_px > sw) ? sw - x_px : w_px;
+  int16_t r0 = (y_px < 0) ? -y_px : 0;
+  int16_t r1 = (y_px + h_px > shp) ? shp - y_px : h_px;
+
+  if(bitmap.w == 0 || bitmap.h == 0 || c0 >= c1 || r0 >= r1)
+    return;
+
+  // nearest neighbour: destination pixel center is mapped to the source
+  for(int16_t c = c0; c < c1; c++)
+  {
+    uint8_t sc = ((2*c + 1) * bitmap.w) / (2*w_px);
+    col_map[c - c0] = (flip & FLIP_H) ? bitmap.w - 1 - sc : sc;
+  }
+
+  uint8_t pg_first = 0xFF, pg_last = 0;
+
+  for(int16_t r = r0; r < r1; r++)
+  {
+    uint8_t sr = ((2*r + 1) * bitmap.h) / (2*h_px);
+    sr = (flip & FLIP_V) ? bitmap.h - 1 - sr : sr;
+    row_map[r - r0] = sr;
+
+    if((sr >> 3) < pg_first) pg_first = sr >> 3;
+    if((sr >> 3) > pg_last)  pg_last = sr >> 3;
+  }
+
+  uint64_t bits = 0;
 
-    if(bitmap.w % 8)
+  // visible rows are written by bands of 64 (rotated segment may be 128 px high)
+  for(int16_t band = r0; band < r1; band += 64)
+  {
+    int16_t band_end = (r1 - band > 64) ? band + 64 : r1;
+
+    for(int16_t c = c0; c < c1; c++)
     {
-      for(uint8_t b=0; b < (bitmap.w % 8); b++)
-        draw_pixel(x_px + ((bitmap.w >> 3) << 3) + b, y_px + dy, (bitmap.data[idx]>>(7-b) & 0x01));
-      idx++;
+      if(c == c0 || col_map[c - c0] != col_map[c - c0 - 1])
+      {
+        for(uint8_t pg = pg_first; pg <= pg_last; pg++)
+          col_pages[pg] = src.get_page_byte(col_map[c - c0], pg*8);
+
+        bits = 0;
+        for(int16_t r = band_end - 1; r >= band; r--)
+          bits = (bits << 1) | ((col_pages[row_map[r - r0] >> 3] >> (row_map[r - r0] & 0x07)) & 0x01);
+      }
+
+      put_column(x_px + c, y_px + band, bits, band_end - band, true);
     }
   }
 
   if(upd_mode == SEGMENT_UPDATE_MODE::IMMEDIATELY)
-    update_part(x_px, y_px, x_px + (bitmap.w-1), y_px + (bitmap.h-1));
+    update_clipped(x_px, y_px, x_px + (w_px-1), y_px + (h_px-1));
+}
+
+
+
+
+/**
+ * @brief Create blit source from page formatted data. Pages follow one after another, like in HORIZONTAL segment
+ * 
+ * @param page_data                   pointer to data: ((height_px + 7) / 8) pages, "width_px" bytes each
+ * @param width_px                    width of the source in px
+ * @param height_px                   height of the source in px
+ */
+BlitSource::BlitSource(const uint8_t* page_data, uint8_t width_px, uint8_t height_px) : 
+  data(page_data), format(SSD1306_SRC_FORMAT::PAGES), w(width_px), h(height_px), col_step(1), line_step(width_px){}
+
+
+/**
+ * @brief Create blit source from data of any supported format
+ * 
+ * @param src_data                    pointer to data
+ * @param src_format                  SSD1306_SRC_FORMAT:: [PAGES, ROWS]
+ * @param width_px                    width of the source in px
+ * @param height_px                   height of the source in px
+ * @param column_step                 PAGES: offset between neighbouring columns in bytes (not used for ROWS)
+ * @param line_step                   PAGES: offset between neighbouring pages in bytes, ROWS: size of one row in bytes
+ */
+BlitSource::BlitSource(const uint8_t* src_data, SSD1306_SRC_FORMAT src_format, uint8_t width_px, uint8_t height_px, uint16_t column_step, uint16_t _line_step) : 
+  data(src_data), format(src_format), w(width_px), h(height_px), col_step(column_step), line_step(_line_step){}
+
+
+/**
+ * @brief Create blit source from bitmap
+ * @param bitmap                      Bitmap object
+ */
+BlitSource::BlitSource(const Bitmap& bitmap) : 
+  data(bitmap.data), 
+  format((bitmap.format == BITMAP_FORMAT::PAGE_MAJOR) ? SSD1306_SRC_FORMAT::PAGES : SSD1306_SRC_FORMAT::ROWS), 
+  w(bitmap.w), h(bitmap.h), col_step(1), 
+  line_step((bitmap.format == BITMAP_FORMAT::PAGE_MAJOR) ? bitmap.w : (bitmap.w + 7) / 8){}
+
+
+/**
+ * @brief Create blit source from segment graphical memory
+ * @param segment                     display segment
+ */
+BlitSource::BlitSource(const DispSegment& segment) : 
+  data(segment.gram), format(SSD1306_SRC_FORMAT::PAGES), w(segment.sw), h(segment.shp),
+  col_step((segment.addr_mode == SSD1306_ADDR_MODE::VERTICAL) ? segment.sh : 1),
+  line_step((segment.addr_mode == SSD1306_ADDR_MODE::VERTICAL) ? 1 : segment.sw){}
+
+
+
+
+/**
+ * @brief Returns 8 vertical pixels of the source column in page byte format (LSB is the upper pixel). Pixels outside the source are 0
+ * 
+ * @param x_px                        column in px
+ * @param y_px                        row of the upper pixel in px [-7 .. h-1]
+ * @return                            page byte
+ */
+uint8_t BlitSource::get_page_byte(uint8_t x_px, int16_t y_px) const
+{
+  if(format == SSD1306_SRC_FORMAT::PAGES)
+  {
+    int16_t pg = ((y_px + 8) >> 3) - 1;
+    uint8_t shift = (y_px + 8) % 8;
+    const uint8_t* col = data + x_px*col_step;
+    uint16_t word = 0;
+
+    if(pg >= 0)
+      word = col[pg*line_step];
+    if(shift && (pg + 1)*8 < h)
+      word |= col[(pg + 1)*line_step] << 8;
+
+    return word >> shift;
+  }
+  else
+  {
+    const uint8_t* cell = data + (x_px >> 3);
+    uint8_t bit = 7 - (x_px % 8);
+    uint8_t byte = 0;
+
+    for(uint8_t k = 0; k < 8; k++)
+      if(y_px + k >= 0 && y_px + k < h)
+        byte |= ((cell[(y_px + k)*line_step] >> bit) & 0x01) << k;
+
+    return byte;
+  }
+}
+
+
+
+
+/**
+ * @brief Returns 8 neighbouring source columns in page byte format. For row-major sources 8 row bytes are converted 
+ *        by one 8x8 bit transpose instead of 64 single pixel reads. Pixels below or above the source are 0
+ * 
+ * @param x_px                        first column in px
+ * @param y_px                        row of the upper pixel in px [-7 .. h-1]
+ * @param block                       array of 8 page bytes to fill: block[0] is column "x_px"
+ */
+void BlitSource::get_page_block(uint8_t x_px, int16_t y_px, uint8_t* block) const
+{
+  if(format == SSD1306_SRC_FORMAT::PAGES)
+  {
+    for(uint8_t c = 0; c < 8; c++)
+      block[c] = (x_px + c < w) ? get_page_byte(x_px + c, y_px) : 0;
+    return;
+  }
+
+  const uint8_t* cell = data + (x_px >> 3);
+  uint8_t shift = x_px % 8;
+  bool next_cell = shift && ((x_px >> 3) + 1 < line_step);
+  uint64_t rows = 0;
+
+  for(uint8_t k = 0; k < 8; k++)
+  {
+    if(y_px + k < 0 || y_px + k >= h)
+      continue;
+
+    const uint8_t* row = cell + (y_px + k)*line_step;
+    uint16_t bits = (row[0] << 8) | (next_cell ? row[1] : 0);
+
+    rows |= (uint64_t)(uint8_t)(bits >> (8 - shift)) << (8*k);
+  }
+
+  rows = transpose8x8(rows);
+
+  // MSB of the row byte is the left column, so the left column is the last byte of the transposed matrix
+  for(uint8_t c = 0; c < 8; c++)
+    block[c] = rows >> (8*(7 - c));
+}
+
+
+
+
+/**
+* @brief Combines source byte with segment byte according to raster operation. Only bits set in mask are changed
+*/
+static inline uint8_t apply_rop(uint8_t dst, uint8_t src, uint8_t mask, SSD1306_ROP rop)
+{
+  switch(rop)
+  {
+    case SSD1306_ROP::COPY:   return (dst & ~mask) | (src & mask);
+    case SSD1306_ROP::OR:     return dst | (src & mask);
+    case SSD1306_ROP::AND:    return dst & (src | ~mask);
+    case SSD1306_ROP::XOR:    return dst ^ (src & mask);
+    case SSD1306_ROP::ANDNOT: return dst & ~(src & mask);
+    case SSD1306_ROP::NOT:    return (dst & ~mask) | (~src & mask);
+  }
+  return dst;
+}
+
+
+
+
+/**
+* @brief Draws rectangular part of the source into the segment. Works with whole page bytes: 
+*        source bytes are shifted to the destination page by two-page shift, the first and last pages are masked.
+*        Source part and destination are clipped, so destination coordinates may be negative.
+*
+* @note Like "draw_pixel" it is a primitive, so it never updates the screen by itself
+*
+* @param[in] src                         pixel source: page formatted data, segment or bitmap
+* @param[in] src_rect                    part of the source to draw (px)
+* @param[in] dst_x_px                    x coordinate of the destination left upper corner in px
+* @param[in] dst_y_px                    y coordinate of the destination left upper corner in px
+* @param[in] rop                         (optional, def = COPY) raster operation SSD1306_ROP:: [COPY, OR, AND, XOR, ANDNOT, NOT]
+*/
+void DispSegment::blit(const BlitSource& src, DispRect src_rect, int16_t dst_x_px, int16_t dst_y_px, SSD1306_ROP rop)
+{
+  static const uint8_t zero = 0;
+  DispRect& r = src_rect;
+
+  // clip by source borders
+  if(r.x < 0) {dst_x_px -= r.x; r.w += r.x; r.x = 0;}
+  if(r.y < 0) {dst_y_px -= r.y; r.h += r.y; r.y = 0;}
+  if(r.x + r.w > src.w) r.w = src.w - r.x;
+  if(r.y + r.h > src.h) r.h = src.h - r.y;
+
+  // clip by segment borders
+  if(dst_x_px < 0) {r.x -= dst_x_px; r.w += dst_x_px; dst_x_px = 0;}
+  if(dst_y_px < 0) {r.y -= dst_y_px; r.h += dst_y_px; dst_y_px = 0;}
+  if(dst_x_px + r.w > sw) r.w = sw - dst_x_px;
+  if(dst_y_px + r.h > shp) r.h = shp - dst_y_px;
+
+  if(r.w <= 0 || r.h <= 0)
+    return;
+
+  uint8_t start_page = dst_y_px >> 3;
+  uint8_t end_page = (dst_y_px + r.h - 1) >> 3;
+  uint16_t dst_step = col_step();
+
+  for(uint8_t pg = start_page; pg <= end_page; pg++)
+  {
+    uint8_t mask = 0xFF;
+    if(pg == start_page) mask &= 0xFF << (dst_y_px % 8);
+    if(pg == end_page)   mask &= 0xFF >> (7 - ((dst_y_px + r.h - 1) % 8));
+
+    int16_t src_y = r.y + pg*8 - dst_y_px;                               // source row that goes to the upper bit of this page
+    uint8_t* dst = page_ptr(dst_x_px, pg);
+
+    if(src.format == SSD1306_SRC_FORMAT::PAGES)
+    {
+      // the page byte is assembled from two neighbouring source pages
+      int16_t src_pg = ((src_y + 8) >> 3) - 1;
+      uint8_t shift = (src_y + 8) % 8;
+
+      const uint8_t* lo = &zero;
+      const uint8_t* hi = &zero;
+      uint16_t lo_step = 0, hi_step = 0;
+
+      if(src_pg >= 0)
+        {lo = src.data + src_pg*src.line_step + r.x*src.col_step; lo_step = src.col_step;}
+      if(shift && (src_pg + 1)*8 < src.h)
+        {hi = src.data + (src_pg + 1)*src.line_step + r.x*src.col_step; hi_step = src.col_step;}
+
+      if(rop == SSD1306_ROP::COPY && mask == 0xFF && shift == 0 && lo_step == 1 && dst_step == 1)
+        memcpy(dst, lo, r.w);                                           // page aligned copy
+      else if(rop == SSD1306_ROP::COPY && mask == 0xFF && shift == 0)
+        for(uint8_t col = 0; col < r.w; col++, dst += dst_step, lo += lo_step)
+          *dst = *lo;                                                   // page aligned copy with column steps (vertical segments)
+      else
+        for(uint8_t col = 0; col < r.w; col++, dst += dst_step, lo += lo_step, hi += hi_step)
+          *dst = apply_rop(*dst, (uint8_t)((*lo | (*hi << 8)) >> shift), mask, rop);
+    }
+    else
+    {
+      // row-major source is converted by 8x8 blocks
+      uint8_t block[8];
+
+      for(uint8_t col = 0; col < r.w; col += 8)
+      {
+        src.get_page_block(r.x + col, src_y, block);
+
+        for(uint8_t c = 0; c < 8 && col + c < r.w; c++, dst += dst_step)
+          *dst = apply_rop(*dst, block[c], mask, rop);
+      }
+    }
+  }
+}
+
+
+
+
+/**
+* @brief Draws the whole source into the segment. See "blit" description above
+* @param[in] src                         pixel source: page formatted data, segment or bitmap
+* @param[in] dst_x_px                    x coordinate of the destination left upper corner in px
+* @param[in] dst_y_px                    y coordinate of the destination left upper corner in px
+* @param[in] rop                         (optional, def = COPY) raster operation SSD1306_ROP:: [COPY, OR, AND, XOR, ANDNOT, NOT]
+*/
+void DispSegment::blit(const BlitSource& src, int16_t dst_x_px, int16_t dst_y_px, SSD1306_ROP rop)
+{
+  blit(src, DispRect{0, 0, src.w, src.h}, dst_x_px, dst_y_px, rop);
 }
-   
     
 
 
+
 /**
 * @brief Redraws full segment area
 */
 void DispSegment::update(void)
 {
+  if(rotation != SSD1306_ROTATION::R0)
+  {
+    update_rotated(0, 0, sw - 1, shp - 1);
+    return;
+  }
+
   if(disp.curr_segment_id != id || disp.segment_part_updated)
   {
     disp.segment_part_updated = false;
@@ -1060,6 +2799,12 @@ void DispSegment::update_row(uint8_t y_px, Font &font){
 */
 void DispSegment::update_part(uint8_t xs_px, uint8_t ys_px, uint8_t xe_px, uint8_t ye_px)
 {  
+  if(rotation != SSD1306_ROTATION::R0)
+  {
+    update_rotated(xs_px, ys_px, xe_px, ye_px);
+    return;
+  }
+
   disp.segment_part_updated = true;
   
   if(disp.curr_segment_id != id)
@@ -1092,14 +2837,140 @@ void DispSegment::update_part(uint8_t xs_px, uint8_t ys_px, uint8_t xe_px, uint8
     else
     {
       for(uint8_t col = range_xs; col <= range_xe; col++)
-        disp.iface.WriteData(&gram[col*sh + range_ys], range_ye-range_ys+1);
+        disp.iface.WriteData(&gram[(col-cs)*sh + (range_ys-ps)], range_ye-range_ys+1);
+    }
+  }
+}
+
+
+
+
+/**
+* @brief Redraws the specified area of the rotated segment. Segment memory holds the rotated (logical) image,
+*        so it is converted to display orientation on the fly: by 8x8 bit transpose of page blocks for R90 and R270,
+*        by bit reverse for R180. Display is always written in horizontal addressing mode, one transfer per display page
+* @param[in] xs_px                    x start area coordinate in px
+* @param[in] ys_px                    y start area coordinate in px
+* @param[in] xe_px                    x end area coordinate in px
+* @param[in] ye_px                    y end area coordinate in px
+*/
+void DispSegment::update_rotated(uint8_t xs_px, uint8_t ys_px, uint8_t xe_px, uint8_t ye_px)
+{
+  const uint8_t wp = ce - cs + 1;                     // physical segment width (px)
+  const uint8_t hp = (pe - ps + 1)*8;                 // physical segment heigth (px)
+  uint8_t pxs, pxe, pys, pye;                         // physical area
+  uint8_t block[8];
+  uint8_t* row;
+
+  static uint8_t rows[2][128];                        // double buffer: one row may still be sent by DMA while next one is built
+  static uint8_t row_idx = 0;
+
+  switch(rotation)
+  {
+    case SSD1306_ROTATION::R90:   pxs = wp-1-ye_px; pxe = wp-1-ys_px; pys = xs_px;       pye = xe_px;       break;
+    case SSD1306_ROTATION::R180:  pxs = wp-1-xe_px; pxe = wp-1-xs_px; pys = hp-1-ye_px;  pye = hp-1-ys_px;  break;
+    default:                      pxs = ys_px;      pxe = ye_px;      pys = hp-1-xe_px;  pye = hp-1-xs_px;  break;
+  }
+
+  disp.segment_part_updated = true;
+  disp.curr_segment_id = id;
+  disp.set_addr_mode(SSD1306_ADDR_MODE::HORIZONTAL);
+  disp.set_hv_range(cs + pxs, cs + pxe, ps + (pys >> 3), ps + (pye >> 3));
+
+  for(uint8_t pg = pys >> 3; pg <= (pye >> 3); pg++)
+  {
+    row = rows[row_idx];
+    row_idx ^= 1;
+
+    if(rotation == SSD1306_ROTATION::R180)
+    {
+      for(uint8_t px = pxs; px <= pxe; px++)
+        row[px - pxs] = reverse_bits8(*page_ptr(wp-1-px, sh-1-pg));
+    }
+    else
+    {
+      for(uint8_t bx = pxs & ~0x07; bx <= pxe; bx += 8)
+      {
+        get_rotated_block(bx, pg, block);
+
+        for(uint8_t c = 0; c < 8; c++)
+          if(bx + c >= pxs && bx + c <= pxe)
+            row[bx + c - pxs] = block[c];
+      }
     }
+
+    disp.iface.WriteData(row, pxe - pxs + 1);
+  }
+}
+
+
+
+
+/**
+* @brief Builds 8 display bytes of R90 or R270 rotated segment: physical columns [x_px .. x_px+7] of physical page pg.
+*        They are 8 segment bytes (8 columns of one page) transposed as 8x8 bit matrix
+* @param[in] x_px                     physical column, multiple of 8
+* @param[in] pg                       physical page
+* @param[out] block                   8 display bytes
+*/
+void DispSegment::get_rotated_block(uint8_t x_px, uint8_t pg, uint8_t* block)
+{
+  uint64_t m = 0;
+
+  if(rotation == SSD1306_ROTATION::R90)
+  {
+    // physical column x+j is segment row (shp-1-x-j), physical row pg*8+b is segment column pg*8+b
+    uint8_t seg_pg = (shp - 1 - x_px) >> 3;
+
+    for(uint8_t b = 0; b < 8; b++)
+      m |= (uint64_t)*page_ptr(pg*8 + b, seg_pg) << (8*b);
+
+    m = transpose8x8(m);
+
+    for(uint8_t c = 0; c < 8; c++)
+      block[c] = m >> (8*(7 - c));
+  }
+  else
+  {
+    // physical column x+j is segment row x+j, physical row pg*8+b is segment column (sw-1-pg*8-b)
+    uint8_t seg_x = sw - 8 - pg*8;
+
+    for(uint8_t b = 0; b < 8; b++)
+      m |= (uint64_t)*page_ptr(seg_x + 7 - b, x_px >> 3) << (8*b);
+
+    m = transpose8x8(m);
+
+    for(uint8_t c = 0; c < 8; c++)
+      block[c] = m >> (8*c);
   }
 }
 
 
 
 
+/**
+* @brief Redraws the specified display area, which may be partially outside of the segment. The area is clipped by segment borders
+* @param[in] xs_px                    x start area coordinate in px
+* @param[in] ys_px                    y start area coordinate in px
+* @param[in] xe_px                    x end area coordinate in px
+* @param[in] ye_px                    y end area coordinate in px
+*/
+void DispSegment::update_clipped(int16_t xs_px, int16_t ys_px, int16_t xe_px, int16_t ye_px)
+{
+  if(xs_px < 0) xs_px = 0;
+  if(ys_px < 0) ys_px = 0;
+  if(xe_px >= sw) xe_px = sw - 1;
+  if(ye_px >= shp) ye_px = shp - 1;
+
+  if(xs_px > xe_px || ys_px > ye_px)
+    return;
+
+  update_part(xs_px, ys_px, xe_px, ye_px);
+}
+
+
+
+
 // static class field that specifies the number of displays in the system
 uint8_t SSD1306_Display::display_qnt = 0;
 
@@ -1109,12 +2980,13 @@ uint8_t SSD1306_Display::display_qnt = 0;
  * @param resolution                  resolution of different displays - SSD1306_SCREEN_RESOLUTION:: [W128xH64, W128xH32, W64xH48, W64xH32]
  * @param interface                   hardware intetrface must be instance of SSD1306_LL_INTERFACE class
  * @param address                     display address. For I2C interface always equals (0x3C << 1)
+ * @param rotation                    (optional, def = R0) software rotation of default segment SSD1306_ROTATION:: [R0, R90, R180, R270]
  * @return                            pointer to new instance of SSD1306_Display
  * 
  * @note Display instance have its own default layout with one horizontal addressed segment. 
  * @note You can call all segment methods throught display object. This is made for simplicity
  */
-SSD1306_Display* SSD1306_Display::create(SSD1306_SCREEN_RESOLUTION resolution, void *interface, uint8_t address)
+SSD1306_Display* SSD1306_Display::create(SSD1306_SCREEN_RESOLUTION resolution, void *interface, uint8_t address, SSD1306_ROTATION rotation)
 {
     uint8_t* gram_ptr;
     uint8_t w;
@@ -1146,7 +3018,7 @@ SSD1306_Display* SSD1306_Display::create(SSD1306_SCREEN_RESOLUTION resolution, v
     gram_ptr = (uint8_t*)malloc((w * h) / 8);
     if(gram_ptr == 0)   while(1);
 
-    return new SSD1306_Display(display_qnt++, 128, 64, (void*)interface, address, gram_ptr);
+    return new SSD1306_Display(display_qnt++, 128, 64, (void*)interface, address, gram_ptr, rotation);
 }
 
 
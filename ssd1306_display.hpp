@@ -2,6 +2,7 @@
 
 #include "ssd1306_ll_interface.hpp"
 #include "ssd1306_fonts.hpp"
+#include "ssd1306_format.hpp"
 #include "ssd1306_bitmaps.hpp"
 
 
@@ -15,6 +16,7 @@ enum SSD1306_PROW_INDEXES {PROW1 = 0, PROW2 = 1, PROW3 = 2, PROW4 = 3, PROW5 = 4
 enum class SSD1306_MIRROR_VERT{ SSD1306_MIRROR_VERT_OFF = 0, SSD1306_MIRROR_VERT_ON = 1};
 enum class SSD1306_MIRROR_HORIZ{ SSD1306_MIRROR_HORIZ_OFF = 0, SSD1306_MIRROR_HORIZ_ON = 1};
 enum class SSD1306_ADDR_MODE{HORIZONTAL = 0, VERTICAL = 1, PAGE = 2};
+enum class SSD1306_ROTATION{R0 = 0, R90 = 1, R180 = 2, R270 = 3};             // software rotation of segment content (clockwise). R90, R270 swap segment width and height
 
 enum class SSD1306_FADE_FRAMES{F8, F16, F24, F32, F40, F48, F56, F64, F72, F80, F88, F96, F104, F112, F120, F128};
 
@@ -30,20 +32,104 @@ enum class SSD1306_ITEM_SELECT_METHOD{                  // determines image meth
 
 enum class SEGMENT_UPDATE_MODE{
     ON_DEMAND,                                          // screen updates after user calling "update" functions
-    IMMEDIATELY                                         // screen updates immediately after calling "draw" functions (except primitives like "write_char", "write_string", "draw_pixel", "draw_hline", "draw_vline")
+    IMMEDIATELY                                         // screen updates immediately after calling "draw" functions (except primitives like "write_char", "write_string", "draw_pixel", "fill_area", "draw_hline", "draw_vline")
 };                                                      // some primitive functions have their own implementations of immediate redraw - i.e. - "write_string_now", "write_num_now"
 
 
+enum class SSD1306_ROP{                                 // raster operation of "blit": how source pixels (S) are combined with segment pixels (D)
+    COPY,                                               // D = S
+    OR,                                                 // D = D | S
+    AND,                                                // D = D & S
+    XOR,                                                // D = D ^ S
+    ANDNOT,                                             // D = D & ~S   (clears pixels that are set in source)
+    NOT                                                 // D = ~S
+};
+
+
+enum class SSD1306_SRC_FORMAT{
+    PAGES,                                              // every byte is 8 vertical pixels, LSB is the upper one (ssd1306 GRAM format)
+    ROWS                                                // every byte is 8 horizontal pixels, MSB is the left one (see ssd1306_bitmaps.cpp)
+};
+
+
+struct DispRect
+{
+    int16_t x, y;                                       // left upper corner (px)
+    int16_t w, h;                                       // width and height (px)
+};
+
+
+struct FillPattern                                      // 8x8 fill pattern: page byte of every column (LSB is the upper pixel), repeated every 8 columns
+{
+    uint8_t col[8];
+};
+
+constexpr FillPattern PATTERN_SOLID      = {{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}};
+constexpr FillPattern PATTERN_EMPTY      = {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+constexpr FillPattern PATTERN_BAYER12    = {{0x11, 0x00, 0x44, 0x00, 0x11, 0x00, 0x44, 0x00}};     // ordered dither (4x4 Bayer matrix), 12.5% of pixels
+constexpr FillPattern PATTERN_BAYER25    = {{0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00}};     // 25%
+constexpr FillPattern PATTERN_BAYER50    = {{0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA}};     // 50% (1 px checkerboard)
+constexpr FillPattern PATTERN_BAYER75    = {{0x55, 0xFF, 0x55, 0xFF, 0x55, 0xFF, 0x55, 0xFF}};     // 75%
+constexpr FillPattern PATTERN_CHECKER    = {{0x0F, 0x0F, 0x0F, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0}};     // 4 px checkerboard
+constexpr FillPattern PATTERN_HATCH      = {{0x11, 0x88, 0x44, 0x22, 0x11, 0x88, 0x44, 0x22}};     // diagonal lines "/"
+constexpr FillPattern PATTERN_HATCH_BACK = {{0x11, 0x22, 0x44, 0x88, 0x11, 0x22, 0x44, 0x88}};     // diagonal lines "\"
+constexpr FillPattern PATTERN_CROSSHATCH = {{0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x44, 0xAA}};     // diagonal grid
+constexpr FillPattern PATTERN_HLINES     = {{0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11}};     // horizontal lines
+constexpr FillPattern PATTERN_VLINES     = {{0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00}};     // vertical lines
+
+
+enum SSD1306_BITMAP_FLIP{                               // bitmap mirroring, may be combined: FLIP_H | FLIP_V
+    FLIP_NONE       = 0x00,
+    FLIP_H          = 0x01,                             // left <-> right
+    FLIP_V          = 0x02                              // top <-> bottom
+};
+
+
+enum class SSD1306_TEXT_ALIGN{LEFT, CENTER, RIGHT};     // horizontal alignment of text box rows
+
+enum SSD1306_TEXT_FLAGS{                                // text box options, may be combined: TEXT_WRAP | TEXT_ELLIPSIS
+    TEXT_CLIP       = 0x00,                             // rows are not wrapped, text outside the box is clipped
+    TEXT_WRAP       = 0x01,                             // rows are wrapped by words (by chars if word is longer than the box)
+    TEXT_ELLIPSIS   = 0x02                              // text that does not fit is replaced with "..."
+};
+
 
 
 
 class SSD1306_Display;
+class DispSegment;
+
+
+class BlitSource                                        // describes pixel data which can be drawn by "DispSegment::blit"
+{
+    public:
+    const uint8_t* const data;
+    const SSD1306_SRC_FORMAT format;
+    const uint8_t w;                                    // source width (px)
+    const uint8_t h;                                    // source heigth (px)
+    const uint16_t col_step;                            // PAGES: offset between neighbouring columns (bytes)
+    const uint16_t line_step;                           // PAGES: offset between neighbouring pages (bytes), ROWS: row size (bytes)
+
+    BlitSource(const uint8_t* page_data, uint8_t width_px, uint8_t height_px);
+    BlitSource(const uint8_t* src_data, SSD1306_SRC_FORMAT src_format, uint8_t width_px, uint8_t height_px, uint16_t column_step, uint16_t line_step);
+    BlitSource(const Bitmap& bitmap);
+    BlitSource(const DispSegment& segment);
+
+    uint8_t get_page_byte(uint8_t x_px, int16_t y_px) const;
+    void get_page_block(uint8_t x_px, int16_t y_px, uint8_t* block) const;
+};
+
 
 class DispSegment
 {
+    friend class BlitSource;
+    friend class TileMap;
+    friend class GrayCanvas;
+
     public:
     const uint8_t id;                               // uniq segment id
     const SSD1306_ADDR_MODE addr_mode;
+    const SSD1306_ROTATION rotation;
 
     private:
     SSD1306_Display& disp;
@@ -66,12 +152,16 @@ class DispSegment
     uint8_t x, y = 0;                               // Cursor (px)
 
     public:
-    DispSegment(uint8_t segment_id, SSD1306_ADDR_MODE _addr_mode, uint8_t col_start, uint8_t page_start, uint8_t col_end, uint8_t page_end, SSD1306_Display& display, uint8_t* segment_gram_ptr, unsigned segment_size) :
+    DispSegment(uint8_t segment_id, SSD1306_ADDR_MODE _addr_mode, uint8_t col_start, uint8_t page_start, uint8_t col_end, uint8_t page_end, SSD1306_Display& display, uint8_t* segment_gram_ptr, unsigned segment_size, SSD1306_ROTATION _rotation = SSD1306_ROTATION::R0) :
         id(segment_id), 
         addr_mode(_addr_mode), 
+        rotation(_rotation),
         cs(col_start), ps(page_start), ce(col_end), pe(page_end), 
         disp(display), gram(segment_gram_ptr), segment_sz(segment_size), 
-        sw(col_end - col_start + 1), sh(page_end - page_start + 1), shp((page_end - page_start + 1)*8),
+        // R90 and R270 (odd rotation values): logical width is physical height, logical height is physical width
+        sw(((uint8_t)_rotation & 0x01) ? (page_end - page_start + 1)*8 : col_end - col_start + 1), 
+        sh(((uint8_t)_rotation & 0x01) ? (col_end - col_start + 1)/8 : page_end - page_start + 1), 
+        shp(((uint8_t)_rotation & 0x01) ? col_end - col_start + 1 : (page_end - page_start + 1)*8),
         upd_mode(SEGMENT_UPDATE_MODE::ON_DEMAND),
         select_method(SSD1306_ITEM_SELECT_METHOD::ARROW),
         text_vertical_mode(false){}
@@ -92,6 +182,8 @@ class DispSegment
     void clear_part(uint8_t xs_px, uint8_t ys_px, uint8_t xe_px, uint8_t ye_px, bool color_noinv = true);
 
     void draw_pixel(uint8_t x_px, uint8_t y_px, bool pix_en = true);
+    void fill_area(int16_t x_px, int16_t y_px, int16_t w_px, int16_t h_px, bool color_noinv = true);
+    void fill_area(int16_t x_px, int16_t y_px, int16_t w_px, int16_t h_px, const FillPattern &pattern);
 
     inline bool set_cursor(uint8_t curs_x, uint8_t curs_y){if(curs_x<sw && curs_y<shp) {x = curs_x; y = curs_y; return true;} return false;}
     inline bool check_cursor(uint8_t curs_x, uint8_t curs_y) {return curs_x<sw && curs_y<shp;}
@@ -101,31 +193,56 @@ class DispSegment
     bool write_char(char ch, Font &font, bool color_noinv, bool no_interval = false);
     void write_string(uint8_t x_px, uint8_t y_px, const char* str, Font &font, bool color_noinv = true);
     void write_string_now(uint8_t x_px, uint8_t y_px, const char* str, Font &font, bool color_noinv = true);
+    void write_string(uint8_t x_px, uint8_t y_px, const MeasuredString &mstr, bool color_noinv = true);
+    DispRect write_text_box(const DispRect &box, const char* str, Font &font, SSD1306_TEXT_ALIGN align = SSD1306_TEXT_ALIGN::LEFT, uint8_t flags = TEXT_WRAP, bool color_noinv = true);
+    DispRect write_text_box(const DispRect &box, const MeasuredString &mstr, SSD1306_TEXT_ALIGN align = SSD1306_TEXT_ALIGN::LEFT, uint8_t flags = TEXT_WRAP, bool color_noinv = true);
+    void write_string_now(uint8_t x_px, uint8_t y_px, const MeasuredString &mstr, bool color_noinv = true);
+    void write_label(int16_t x_px, int16_t y_px, const StaticLabel &label, bool color_noinv = true);
     void write_num(uint8_t x_px, uint8_t y_px, signed num, Font &font, bool color_noinv = true);
     void write_num_sign(uint8_t x_px, uint8_t y_px, signed num, Font &font, bool color_noinv = true);
     void write_num_now(uint8_t x_px, uint8_t y_px, signed num, Font &font, bool color_noinv = true);
+    void write_num(uint8_t x_px, uint8_t y_px, signed num, const NumFormat &fmt, Font &font, bool color_noinv = true);
+    void write_num_now(uint8_t x_px, uint8_t y_px, signed num, const NumFormat &fmt, Font &font, bool color_noinv = true);
+    void write_fixed(uint8_t x_px, uint8_t y_px, signed num, uint8_t decimals, Font &font, bool color_noinv = true);
 
     void clear_font_px(uint8_t x_px, uint8_t y_px, uint8_t sz_px, Font &font, bool color_noinv = true);
     void clear_font_symb(uint8_t x_px, uint8_t y_px, uint8_t sz_symb, Font &font, bool color_noinv = true);
     void clear_font_row(uint8_t y_px, Font &font, bool color_noinv = true);
     uint8_t get_string_size_px(const char* str, Font &font);
     uint8_t get_num_string_size_px(signed num, Font &font);
+    uint8_t get_num_string_size_px(signed num, const NumFormat &fmt, Font &font);
 
     
     void draw_hline(uint8_t x_px, uint8_t y_px, uint8_t w_px, bool color_noinv = true);
     void draw_vline(uint8_t x_px, uint8_t y_px, uint8_t h_px, bool color_noinv = true); 
     void draw_frame(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_px, bool color_noinv = true);
     void draw_box(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_px,  bool color_noinv = true);
+    void draw_box(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_px, const FillPattern &pattern);
 
     void draw_line(uint8_t x1_px, uint8_t y1_px, uint8_t x2_px, uint8_t y2_px, bool color_noinv = true);
     void draw_circle(uint8_t x_px,uint8_t y_px,uint8_t r_px, bool color_noinv = true);
     void draw_filled_circle(uint8_t x_px,uint8_t y_px,uint8_t r_px, bool color_noinv = true);
+    void draw_filled_circle(uint8_t x_px, uint8_t y_px, uint8_t r_px, const FillPattern &pattern);
+    void draw_ellipse(uint8_t x_px, uint8_t y_px, uint8_t rx_px, uint8_t ry_px, bool color_noinv = true);
+    void draw_filled_ellipse(uint8_t x_px, uint8_t y_px, uint8_t rx_px, uint8_t ry_px, bool color_noinv = true);
+    void draw_filled_ellipse(uint8_t x_px, uint8_t y_px, uint8_t rx_px, uint8_t ry_px, const FillPattern &pattern);
+    void draw_arc(uint8_t x_px, uint8_t y_px, uint8_t r_px, uint16_t start_deg, uint16_t end_deg, bool color_noinv = true);
+    void draw_rounded_frame(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_px, uint8_t r_px, bool color_noinv = true);
+    void draw_rounded_box(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_px, uint8_t r_px, bool color_noinv = true);
+    void draw_rounded_box(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_px, uint8_t r_px, const FillPattern &pattern);
     
     
 
     void draw_param(uint8_t y_px, const char* str, Font &font, signed p_val, bool selected = false);
+    void draw_param(uint8_t y_px, const char* str, Font &font, signed p_val, const NumFormat &fmt, bool selected = false);
+    void draw_param_fixed(uint8_t y_px, const char* str, Font &font, signed p_val, uint8_t decimals, bool selected = false);
     void draw_param(uint8_t y_px, const char* str, Font &font, const char* p_str, bool selected = false);
+    void draw_param(uint8_t y_px, const char* str, const MeasuredString &p_mstr, bool selected = false);
     void draw_checkbox(uint8_t y_px, const char* str, Font &font, bool checked = false, bool selected = false);
+    void draw_param(uint8_t y_px, const StaticLabel &label, Font &font, signed p_val, bool selected = false);
+    void draw_param(uint8_t y_px, const StaticLabel &label, Font &font, signed p_val, const NumFormat &fmt, bool selected = false);
+    void draw_param(uint8_t y_px, const StaticLabel &label, const MeasuredString &p_mstr, bool selected = false);
+    void draw_checkbox(uint8_t y_px, const StaticLabel &label, Font &font, bool checked = false, bool selected = false);
 
 
     void select_item(uint8_t y_px, Font &font);
@@ -137,10 +254,38 @@ class DispSegment
 
     void draw_accum(uint8_t x_px, uint8_t y_px, uint8_t charge);
     void draw_bitmap(uint8_t x_px, uint8_t y_px, Bitmap &bitmap);
+    void draw_bitmap(int16_t x_px, int16_t y_px, const Bitmap &bitmap, DispRect src_rect);
+    void draw_bitmap(int16_t x_px, int16_t y_px, const BitmapSheet &sheet, uint16_t index);
+    void draw_bitmap_flipped(int16_t x_px, int16_t y_px, const Bitmap &bitmap, uint8_t flip);
+    void draw_bitmap_scaled(int16_t x_px, int16_t y_px, const Bitmap &bitmap, uint8_t w_px, uint8_t h_px, uint8_t flip = FLIP_NONE);
+
+    void blit(const BlitSource& src, DispRect src_rect, int16_t dst_x_px, int16_t dst_y_px, SSD1306_ROP rop = SSD1306_ROP::COPY);
+    void blit(const BlitSource& src, int16_t dst_x_px, int16_t dst_y_px, SSD1306_ROP rop = SSD1306_ROP::COPY);
 
     void update();
     void update_row(uint8_t y_px, Font &font);
     void update_part(uint8_t xs_px, uint8_t ys_px, uint8_t xe_px, uint8_t ye_px);
+    void update_clipped(int16_t xs_px, int16_t ys_px, int16_t xe_px, int16_t ye_px);
+
+    private:
+    inline uint8_t* page_ptr(uint8_t x_px, uint8_t pg) {return (addr_mode == SSD1306_ADDR_MODE::VERTICAL) ? &gram[x_px*sh + pg] : &gram[pg*sw + x_px];}
+    inline uint16_t col_step() const {return (addr_mode == SSD1306_ADDR_MODE::VERTICAL) ? sh : 1;}
+    inline uint16_t page_step() const {return (addr_mode == SSD1306_ADDR_MODE::VERTICAL) ? 1 : sw;}
+
+    void put_column(int16_t x_px, int16_t y_px, uint64_t bits, uint8_t height, bool color_noinv);
+    void write_formatted(NumFormatter nf, Font &font, bool color_noinv);
+    void put_glyph(int16_t x_px, int16_t y_px, Glyph glyph, Font &font, const DispRect &clip, bool color_noinv);
+    DispRect write_text_rows(const DispRect &box, const char* str, Font &font, int16_t str_w, SSD1306_TEXT_ALIGN align, uint8_t flags, bool color_noinv);
+    void write_title(uint8_t x_px, uint8_t y_px, const char* str, const StaticLabel* label, Font &font, bool color_noinv);
+    void draw_param_row(uint8_t y_px, const char* str, const StaticLabel* label, Font &font, signed p_val, const NumFormat &fmt, bool selected);
+    void draw_param_row(uint8_t y_px, const char* str, const StaticLabel* label, const MeasuredString &p_mstr, bool selected);
+    void draw_checkbox_row(uint8_t y_px, const char* str, const StaticLabel* label, Font &font, bool checked, bool selected);
+
+    void update_rotated(uint8_t xs_px, uint8_t ys_px, uint8_t xe_px, uint8_t ye_px);
+    void get_rotated_block(uint8_t x_px, uint8_t pg, uint8_t* block);
+
+    void fill_symmetric_spans(int16_t xl, int16_t xr, int16_t yt, int16_t yb, int16_t dx, int16_t dy, const FillPattern &pattern);
+    void plot_pixel(int16_t x_px, int16_t y_px, bool color_noinv);
 };
 
 
@@ -162,7 +307,7 @@ class DispLayout
     DispLayout(uint8_t layout_id, SSD1306_Display& display, uint8_t* const gram_ptr, unsigned gram_size) : id(layout_id), disp(display), gram(gram_ptr) {gram_available = gram_size; curr_segment_gram_ptr = gram_ptr;}
 
     public:
-    DispSegment* create_segment(SSD1306_ADDR_MODE addr_mode, uint8_t col_start_px, uint8_t page_start_pg, uint8_t col_end_px, uint8_t page_end_pg);
+    DispSegment* create_segment(SSD1306_ADDR_MODE addr_mode, uint8_t col_start_px, uint8_t page_start_pg, uint8_t col_end_px, uint8_t page_end_pg, SSD1306_ROTATION rotation = SSD1306_ROTATION::R0);
 
     static DispLayout* create_layout(SSD1306_Display& display);
 };
@@ -204,25 +349,25 @@ class SSD1306_Display
     
 
     public:
-    static SSD1306_Display* create(SSD1306_SCREEN_RESOLUTION resolution, void *interface, uint8_t address);
+    static SSD1306_Display* create(SSD1306_SCREEN_RESOLUTION resolution, void *interface, uint8_t address, SSD1306_ROTATION rotation = SSD1306_ROTATION::R0);
 
 
 public:
-    SSD1306_Display(uint8_t disp_id, uint8_t w, uint8_t h, void *interface, uint8_t address, uint8_t* gram_ptr) : 
+    SSD1306_Display(uint8_t disp_id, uint8_t w, uint8_t h, void *interface, uint8_t address, uint8_t* gram_ptr, SSD1306_ROTATION rotation = SSD1306_ROTATION::R0) : 
         id(disp_id), 
         WIDTH_PX(w), HEIGHT_PX(h), HEIGHT_PG(h/8), 
         GMEM_SZ((w*h)/8), GRAM_PTR(gram_ptr), 
         iface(interface, address),
         ddl(create_layout()), 
-        dds(ddl->create_segment(SSD1306_ADDR_MODE::HORIZONTAL, 0, 0, WIDTH_PX-1, HEIGHT_PG-1)),
+        dds(ddl->create_segment(SSD1306_ADDR_MODE::HORIZONTAL, 0, 0, WIDTH_PX-1, HEIGHT_PG-1, rotation)),
         segment_part_updated(true),                                                                      // some fix to make the "update" function work correctly first time after init
         addr_mode(SSD1306_ADDR_MODE::HORIZONTAL){}
 
     
     void init(SSD1306_MIRROR_VERT v_mirror, SSD1306_MIRROR_HORIZ h_mirror);
     inline DispLayout* create_layout(void){ return DispLayout::create_layout(*this);}
-    inline DispSegment* create_segment(DispLayout* layout, SSD1306_ADDR_MODE addr_mode, uint8_t col_start_px, uint8_t page_start_pg, uint8_t col_end_px, uint8_t page_end_pg)
-        {return layout->create_segment(addr_mode, col_start_px, page_start_pg, col_end_px, page_end_pg);}
+    inline DispSegment* create_segment(DispLayout* layout, SSD1306_ADDR_MODE addr_mode, uint8_t col_start_px, uint8_t page_start_pg, uint8_t col_end_px, uint8_t page_end_pg, SSD1306_ROTATION rotation = SSD1306_ROTATION::R0)
+        {return layout->create_segment(addr_mode, col_start_px, page_start_pg, col_end_px, page_end_pg, rotation);}
 
    
 
@@ -237,21 +382,32 @@ public:
     inline void clear_row(uint8_t y_pg, bool color_noinv = true){dds->clear_row(y_pg, color_noinv);}
     inline void clear_part(uint8_t xs_px, uint8_t ys_px, uint8_t xe_px, uint8_t ye_px, bool color_noinv = true){dds->clear_part(xs_px, ys_px, xe_px, ye_px, color_noinv);}
     inline void draw_pixel(uint8_t x_px, uint8_t y_px, bool color_noinv = true){dds->draw_pixel(x_px, y_px, color_noinv);}
+    inline void fill_area(int16_t x_px, int16_t y_px, int16_t w_px, int16_t h_px, bool color_noinv = true){dds->fill_area(x_px, y_px, w_px, h_px, color_noinv);}
+    inline void fill_area(int16_t x_px, int16_t y_px, int16_t w_px, int16_t h_px, const FillPattern &pattern){dds->fill_area(x_px, y_px, w_px, h_px, pattern);}
     inline void set_cursor(uint8_t x, uint8_t y){dds->set_cursor(x, y);}
 
  
     inline bool write_char(char ch, Font &font, bool color_noinv = true, bool no_interval = false) {return dds->write_char(ch, font, color_noinv, no_interval);}
     inline void write_string(uint8_t x_px, uint8_t y_px, const char* str, Font &font, bool color_noinv = true) {dds->write_string(x_px, y_px, str, font, color_noinv);}
     inline void write_string_now(uint8_t x_px, uint8_t y_px, const char* str, Font &font, bool color_noinv = true) {dds->write_string_now(x_px, y_px, str, font, color_noinv);}
+    inline void write_string(uint8_t x_px, uint8_t y_px, const MeasuredString &mstr, bool color_noinv = true) {dds->write_string(x_px, y_px, mstr, color_noinv);}
+    inline DispRect write_text_box(const DispRect &box, const char* str, Font &font, SSD1306_TEXT_ALIGN align = SSD1306_TEXT_ALIGN::LEFT, uint8_t flags = TEXT_WRAP, bool color_noinv = true) {return dds->write_text_box(box, str, font, align, flags, color_noinv);}
+    inline DispRect write_text_box(const DispRect &box, const MeasuredString &mstr, SSD1306_TEXT_ALIGN align = SSD1306_TEXT_ALIGN::LEFT, uint8_t flags = TEXT_WRAP, bool color_noinv = true) {return dds->write_text_box(box, mstr, align, flags, color_noinv);}
+    inline void write_string_now(uint8_t x_px, uint8_t y_px, const MeasuredString &mstr, bool color_noinv = true) {dds->write_string_now(x_px, y_px, mstr, color_noinv);}
+    inline void write_label(int16_t x_px, int16_t y_px, const StaticLabel &label, bool color_noinv = true) {dds->write_label(x_px, y_px, label, color_noinv);}
     inline void write_num(uint8_t x_px, uint8_t y_px, signed num, Font &font, bool color_noinv = true){dds->write_num(x_px, y_px, num,font,color_noinv);}
     inline void write_num_sign(uint8_t x_px, uint8_t y_px, signed num, Font &font, bool color_noinv = true){dds->write_num_sign(x_px, y_px, num,font,color_noinv);}
     inline void write_num_now(uint8_t x_px, uint8_t y_px, signed num, Font &font, bool color_noinv = true){dds->write_num_now(x_px, y_px, num,font,color_noinv);}
+    inline void write_num(uint8_t x_px, uint8_t y_px, signed num, const NumFormat &fmt, Font &font, bool color_noinv = true){dds->write_num(x_px, y_px, num, fmt, font, color_noinv);}
+    inline void write_num_now(uint8_t x_px, uint8_t y_px, signed num, const NumFormat &fmt, Font &font, bool color_noinv = true){dds->write_num_now(x_px, y_px, num, fmt, font, color_noinv);}
+    inline void write_fixed(uint8_t x_px, uint8_t y_px, signed num, uint8_t decimals, Font &font, bool color_noinv = true){dds->write_fixed(x_px, y_px, num, decimals, font, color_noinv);}
 
     inline void clear_font_px(uint8_t x_px, uint8_t y_px, uint8_t sz_px, Font &font, bool color_noinv = true){dds->clear_font_px(x_px, y_px, sz_px, font, color_noinv);}
     inline void clear_font_symb(uint8_t x_px, uint8_t y_px, uint8_t sz_symb, Font &font, bool color_noinv = true){dds->clear_font_symb(x_px, y_px, sz_symb, font, color_noinv);}
     inline void clear_font_row(uint8_t y_px, Font &font, bool color_noinv = true){dds->clear_font_row(y_px, font, color_noinv);}
-    inline uint8_t get_string_size_px(char* str, Font &font){return dds->get_string_size_px(str, font);}
+    inline uint8_t get_string_size_px(const char* str, Font &font){return dds->get_string_size_px(str, font);}
     inline uint8_t get_num_string_size_px(signed num, Font &font){return dds->get_num_string_size_px(num, font);}
+    inline uint8_t get_num_string_size_px(signed num, const NumFormat &fmt, Font &font){return dds->get_num_string_size_px(num, fmt, font);}
 
     void draw_hline(uint8_t x_px, uint8_t y_px, uint8_t w_px, bool color_noinv = true){dds->draw_hline(x_px, y_px, w_px, color_noinv);}
     void draw_vline(uint8_t x_px, uint8_t y_px, uint8_t h_px, bool color_noinv = true){dds->draw_vline(x_px, y_px, h_px, color_noinv);} 
@@ -259,14 +415,30 @@ public:
     void draw_line(uint8_t x1_px, uint8_t y1_px, uint8_t x2_px, uint8_t y2_px, bool color_noinv = true){dds->draw_line(x1_px, y1_px, x2_px, y2_px, color_noinv);}
     void draw_frame(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_px, bool color_noinv = true){dds->draw_frame(x_px, y_px, w_px, h_px, color_noinv);}
     void draw_box(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_px, bool color_noinv = true){dds->draw_box(x_px, y_px, w_px, h_px, color_noinv);}
+    void draw_box(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_px, const FillPattern &pattern){dds->draw_box(x_px, y_px, w_px, h_px, pattern);}
 
     void draw_circle(uint8_t x_px, uint8_t y_px, uint8_t r_px, bool color_noinv = true){dds->draw_circle(x_px, y_px, r_px, color_noinv);}
     void draw_filled_circle(uint8_t x_px, uint8_t y_px, uint8_t r_px, bool color_noinv = true){dds->draw_filled_circle(x_px, y_px, r_px, color_noinv);}
+    void draw_filled_circle(uint8_t x_px, uint8_t y_px, uint8_t r_px, const FillPattern &pattern){dds->draw_filled_circle(x_px, y_px, r_px, pattern);}
+    void draw_ellipse(uint8_t x_px, uint8_t y_px, uint8_t rx_px, uint8_t ry_px, bool color_noinv = true){dds->draw_ellipse(x_px, y_px, rx_px, ry_px, color_noinv);}
+    void draw_filled_ellipse(uint8_t x_px, uint8_t y_px, uint8_t rx_px, uint8_t ry_px, bool color_noinv = true){dds->draw_filled_ellipse(x_px, y_px, rx_px, ry_px, color_noinv);}
+    void draw_filled_ellipse(uint8_t x_px, uint8_t y_px, uint8_t rx_px, uint8_t ry_px, const FillPattern &pattern){dds->draw_filled_ellipse(x_px, y_px, rx_px, ry_px, pattern);}
+    void draw_arc(uint8_t x_px, uint8_t y_px, uint8_t r_px, uint16_t start_deg, uint16_t end_deg, bool color_noinv = true){dds->draw_arc(x_px, y_px, r_px, start_deg, end_deg, color_noinv);}
+    void draw_rounded_frame(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_px, uint8_t r_px, bool color_noinv = true){dds->draw_rounded_frame(x_px, y_px, w_px, h_px, r_px, color_noinv);}
+    void draw_rounded_box(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_px, uint8_t r_px, bool color_noinv = true){dds->draw_rounded_box(x_px, y_px, w_px, h_px, r_px, color_noinv);}
+    void draw_rounded_box(uint8_t x_px, uint8_t y_px, uint8_t w_px, uint8_t h_px, uint8_t r_px, const FillPattern &pattern){dds->draw_rounded_box(x_px, y_px, w_px, h_px, r_px, pattern);}
 
 
     void draw_param(uint8_t y_px, const char* str, Font &font, signed p_val, bool selected = false){dds->draw_param(y_px, str, font, p_val, selected);}
+    void draw_param(uint8_t y_px, const char* str, Font &font, signed p_val, const NumFormat &fmt, bool selected = false){dds->draw_param(y_px, str, font, p_val, fmt, selected);}
+    void draw_param_fixed(uint8_t y_px, const char* str, Font &font, signed p_val, uint8_t decimals, bool selected = false){dds->draw_param_fixed(y_px, str, font, p_val, decimals, selected);}
     void draw_param(uint8_t y_px, const char* str, Font &font, const char* p_str, bool selected = false){dds->draw_param(y_px, str, font, p_str, selected);}
+    void draw_param(uint8_t y_px, const char* str, const MeasuredString &p_mstr, bool selected = false){dds->draw_param(y_px, str, p_mstr, selected);}
     void draw_checkbox(uint8_t y_px, const char* str, Font &font, bool checked = false, bool selected = false){dds->draw_checkbox(y_px, str, font, checked, selected);}
+    void draw_param(uint8_t y_px, const StaticLabel &label, Font &font, signed p_val, bool selected = false){dds->draw_param(y_px, label, font, p_val, selected);}
+    void draw_param(uint8_t y_px, const StaticLabel &label, Font &font, signed p_val, const NumFormat &fmt, bool selected = false){dds->draw_param(y_px, label, font, p_val, fmt, selected);}
+    void draw_param(uint8_t y_px, const StaticLabel &label, const MeasuredString &p_mstr, bool selected = false){dds->draw_param(y_px, label, p_mstr, selected);}
+    void draw_checkbox(uint8_t y_px, const StaticLabel &label, Font &font, bool checked = false, bool selected = false){dds->draw_checkbox(y_px, label, font, checked, selected);}
     void draw_hbar(uint8_t y_px, unsigned percent, Font &font, bool color_noinv = true){dds->draw_hbar(y_px, percent, font,  color_noinv);}
 
     void set_select_method(SSD1306_ITEM_SELECT_METHOD _select_method){dds->set_select_method(_select_method);}
@@ -275,6 +447,12 @@ public:
 
 
     void draw_bitmap(uint8_t x_px, uint8_t y_px, Bitmap &bitmap){dds->draw_bitmap(x_px, y_px, bitmap);}
+    void draw_bitmap(int16_t x_px, int16_t y_px, const Bitmap &bitmap, DispRect src_rect){dds->draw_bitmap(x_px, y_px, bitmap, src_rect);}
+    void draw_bitmap(int16_t x_px, int16_t y_px, const BitmapSheet &sheet, uint16_t index){dds->draw_bitmap(x_px, y_px, sheet, index);}
+    void draw_bitmap_flipped(int16_t x_px, int16_t y_px, const Bitmap &bitmap, uint8_t flip){dds->draw_bitmap_flipped(x_px, y_px, bitmap, flip);}
+    void draw_bitmap_scaled(int16_t x_px, int16_t y_px, const Bitmap &bitmap, uint8_t w_px, uint8_t h_px, uint8_t flip = FLIP_NONE){dds->draw_bitmap_scaled(x_px, y_px, bitmap, w_px, h_px, flip);}
+    void blit(const BlitSource& src, DispRect src_rect, int16_t dst_x_px, int16_t dst_y_px, SSD1306_ROP rop = SSD1306_ROP::COPY){dds->blit(src, src_rect, dst_x_px, dst_y_px, rop);}
+    void blit(const BlitSource& src, int16_t dst_x_px, int16_t dst_y_px, SSD1306_ROP rop = SSD1306_ROP::COPY){dds->blit(src, dst_x_px, dst_y_px, rop);}
 
 
     inline void update_screen(void){dds->update();}
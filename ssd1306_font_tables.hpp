@@ -0,0 +1,702 @@
+#pragma once
+
+/*
+ * Raw arrays of the built-in fonts. They are "constexpr", so the fonts may be used at compile time:
+ * packed (ssd1306_fonts.cpp) or rasterized into static labels (see "SSD1306_STATIC_LABEL"). 
+ * Arrays which are not used by the translation unit are not linked.
+ */
+
+#include "ssd1306_fonts.hpp"
+
+
+
+
+//################################### FONT 5 ###################################//
+
+#define FONT_5_CHAR_WIDTH       4
+#define FONT_5_CHAR_HEIGHT      5
+#define FONT_5_CHAR_INTERVAL    1
+
+#define FONT_EN_5_LENGTH        95
+#define FONT_EN_5_START_CHAR    32
+#define FONT_EN_5_ARRAY_LENGTH  (FONT_EN_5_LENGTH * (1 + FONT_5_CHAR_WIDTH))
+
+#define FONT_RU_5_LENGTH        64
+#define FONT_RU_5_START_CHAR    192
+#define FONT_RU_5_ARRAY_LENGTH  (FONT_RU_5_LENGTH * (1 + FONT_5_CHAR_WIDTH))
+
+
+
+constexpr unsigned char  font_en_5[FONT_EN_5_ARRAY_LENGTH] =
+{
+  3, /*N*/ 0x00, 0x00, 0x00, 0x00, //  32  < > 
+  1, /*N*/ 0x17, 0x00, 0x00, 0x00, //  33  <!> 
+  3, /*N*/ 0x03, 0x00, 0x03, 0x00, //  34  <"> 
+  4, /*N*/ 0x0A, 0x1F, 0x0A, 0x1F, //  35  <#> 
+  4, /*N*/ 0x07, 0x11, 0x11, 0x1C, //  36  <$> 
+  3, /*N*/ 0x09, 0x04, 0x12, 0x00, //  37  <%> 
+  4, /*N*/ 0x1F, 0x1F, 0x1F, 0x1F, //  38  <&> 
+  3, /*N*/ 0x00, 0x00, 0x03, 0x00, //  39  <'> 
+  2, /*N*/ 0x0E, 0x11, 0x00, 0x00, //  40  <(> 
+  2, /*N*/ 0x11, 0x0E, 0x00, 0x00, //  41  <)> 
+  3, /*N*/ 0x0A, 0x04, 0x0A, 0x00, //  42  <*> 
+  3, /*N*/ 0x04, 0x0E, 0x04, 0x00, //  43  <+> 
+  2, /*N*/ 0x10, 0x08, 0x00, 0x00, //  44  <,> 
+  3, /*N*/ 0x04, 0x04, 0x04, 0x00, //  45  <-> 
+  1, /*N*/ 0x10, 0x00, 0x00, 0x00, //  46  <.> 
+  4, /*N*/ 0x10, 0x08, 0x04, 0x02, //  47  </> 
+
+    // Digits /  
+  4, /*N*/ 0x0E, 0x11, 0x11, 0x0E, //  48  <0> 
+  3, /*N*/ 0x12, 0x1F, 0x10, 0x00, //  49  <1> 
+  4, /*N*/ 0x19, 0x15, 0x15, 0x12, //  50  <2> 
+  4, /*N*/ 0x15, 0x15, 0x15, 0x0A, //  51  <3> 
+  4, /*N*/ 0x07, 0x04, 0x04, 0x1F, //  52  <4> 
+  4, /*N*/ 0x17, 0x15, 0x15, 0x1D, //  53  <5> 
+  4, /*N*/ 0x1E, 0x15, 0x15, 0x1D, //  54  <6> 
+  4, /*N*/ 0x01, 0x19, 0x05, 0x03, //  55  <7> 
+  4, /*N*/ 0x0A, 0x15, 0x15, 0x0A, //  56  <8> 
+  4, /*N*/ 0x17, 0x15, 0x15, 0x0E, //  57  <9> 
+
+  1, /*N*/ 0x12, 0x00, 0x00, 0x00, //  58  <:> 
+  2, /*N*/ 0x10, 0x0A, 0x00, 0x00, //  59  <;> 
+  3, /*N*/ 0x04, 0x0A, 0x11, 0x00, //  60  <<> 
+  3, /*N*/ 0x0A, 0x0A, 0x0A, 0x00, //  61  <=> 
+  3, /*N*/ 0x11, 0x0A, 0x04, 0x00, //  62  <>> 
+  3, /*N*/ 0x01, 0x15, 0x03, 0x00, //  63  <?> 
+  4, /*N*/ 0x1E, 0x11, 0x0D, 0x0F, //  64  <@> 
+
+    // Roman Capitals / ,  
+  4, /*N*/ 0x1E, 0x09, 0x09, 0x1E, //  65  <A> 
+  4, /*N*/ 0x1F, 0x15, 0x15, 0x0A, //  66  <B> 
+  3, /*N*/ 0x0E, 0x11, 0x11, 0x00, //  67  <C> 
+  4, /*N*/ 0x1F, 0x11, 0x11, 0x0E, //  68  <D> 
+  4, /*N*/ 0x1F, 0x15, 0x15, 0x11, //  69  <E> 
+  4, /*N*/ 0x1F, 0x05, 0x05, 0x01, //  70  <F> 
+  4, /*N*/ 0x0E, 0x11, 0x19, 0x1A, //  71  <G> 
+  4, /*N*/ 0x1F, 0x04, 0x04, 0x1F, //  72  <H> 
+  3, /*N*/ 0x11, 0x1F, 0x11, 0x00, //  73  <I> 
+  4, /*N*/ 0x08, 0x11, 0x1F, 0x01, //  74  <J> 
+  4, /*N*/ 0x1F, 0x04, 0x06, 0x19, //  75  <K> 
+  3, /*N*/ 0x1F, 0x10, 0x10, 0x00, //  76  <L> 
+  4, /*N*/ 0x1F, 0x02, 0x02, 0x1F, //  77  <M> 
+  4, /*N*/ 0x1F, 0x02, 0x04, 0x1F, //  78  <N> 
+  4, /*N*/ 0x0E, 0x11, 0x11, 0x0E, //  79  <O> 
+  4, /*N*/ 0x1F, 0x09, 0x09, 0x06, //  80  <P> 
+  4, /*N*/ 0x0E, 0x11, 0x09, 0x16, //  81  <Q> 
+  4, /*N*/ 0x1F, 0x05, 0x0D, 0x12, //  82  <R> 
+  4, /*N*/ 0x12, 0x15, 0x15, 0x09, //  83  <S> 
+  3, /*N*/ 0x01, 0x1F, 0x01, 0x00, //  84  <T> 
+  4, /*N*/ 0x0F, 0x10, 0x10, 0x0F, //  85  <U> 
+  4, /*N*/ 0x0F, 0x10, 0x10, 0x0F, //  86  <V> 
+  4, /*N*/ 0x0F, 0x18, 0x18, 0x0F, //  87  <W> 
+  4, /*N*/ 0x1B, 0x04, 0x04, 0x1B, //  88  <X> 
+  4, /*N*/ 0x17, 0x14, 0x14, 0x0F, //  89  <Y> 
+  4, /*N*/ 0x19, 0x15, 0x15, 0x13, //  90  <Z> 
+
+  2, /*N*/ 0x1F, 0x11, 0x00, 0x00, //  91  <[> 
+  4, /*N*/ 0x02, 0x04, 0x08, 0x10, //  92  <\> 
+  4, /*N*/ 0x00, 0x00, 0x11, 0x1F, //  93  <]> 
+  3, /*N*/ 0x02, 0x01, 0x02, 0x00, //  94  <^> 
+  4, /*N*/ 0x10, 0x10, 0x10, 0x10, //  95  <_> 
+  4, /*N*/ 0x00, 0x00, 0x01, 0x02, //  96  <`> 
+
+    // Roman Smalls / ,  
+  4, /*N*/ 0x1C, 0x0A, 0x0A, 0x1C, //  97  <a> 
+  4, /*N*/ 0x1F, 0x12, 0x12, 0x0C, //  98  <b> 
+  3, /*N*/ 0x0C, 0x12, 0x12, 0x00, //  99  <c> 
+  4, /*N*/ 0x00, 0x0C, 0x12, 0x1F, //  100 <d> 
+  3, /*N*/ 0x0C, 0x1A, 0x16, 0x00, //  101 <e> 
+  3, /*N*/ 0x04, 0x1F, 0x05, 0x00, //  102 <f> 
+  4, /*N*/ 0x10, 0x16, 0x1A, 0x0C, //  103 <g> 
+  4, /*N*/ 0x1F, 0x02, 0x02, 0x1C, //  104 <h> 
+  1, /*N*/ 0x1D, 0x00, 0x00, 0x00, //  105 <i> 
+  3, /*N*/ 0x08, 0x10, 0x1D, 0x00, //  106 <j> 
+  4, /*N*/ 0x1F, 0x04, 0x0A, 0x10, //  107 <k> 
+  1, /*N*/ 0x1E, 0x00, 0x00, 0x00, //  108 <l> 
+  4, /*N*/ 0x1E, 0x04, 0x04, 0x1E, //  109 <m> 
+  4, /*N*/ 0x1E, 0x02, 0x02, 0x1C, //  110 <n> 
+  4, /*N*/ 0x0C, 0x12, 0x12, 0x0C, //  111 <o> 
+  4, /*N*/ 0x1E, 0x0A, 0x0A, 0x04, //  112 <p> 
+  4, /*N*/ 0x00, 0x04, 0x0A, 0x1E, //  113 <q> 
+  3, /*N*/ 0x1C, 0x02, 0x02, 0x00, //  114 <r> 
+  3, /*N*/ 0x14, 0x1E, 0x0A, 0x00, //  115 <s> 
+  3, /*N*/ 0x02, 0x1F, 0x12, 0x00, //  116 <t> 
+  4, /*N*/ 0x0E, 0x10, 0x10, 0x0E, //  117 <u> 
+  3, /*N*/ 0x0E, 0x10, 0x0E, 0x00, //  118 <v> 
+  4, /*N*/ 0x0E, 0x18, 0x18, 0x0E, //  119 <w> 
+  3, /*N*/ 0x12, 0x0C, 0x12, 0x00, //  120 <x> 
+  3, /*N*/ 0x16, 0x18, 0x0E, 0x00, //  121 <y> 
+  3, /*N*/ 0x12, 0x1A, 0x16, 0x00, //  122 <z> 
+
+  3, /*N*/ 0x04, 0x1B, 0x11, 0x00, //  123 <{> 
+  1, /*N*/ 0x1F, 0x00, 0x00, 0x00, //  124 <|> 
+  3, /*N*/ 0x11, 0x1B, 0x04, 0x00, //  125 <}> 
+  4, /*N*/ 0x04, 0x02, 0x04, 0x02  //  126 <~> 
+};
+
+constexpr unsigned char  font_ru_5[FONT_RU_5_ARRAY_LENGTH] =
+{
+
+  // Cyrillic Capitals / ,  
+4, /*N*/ 0x1E, 0x09, 0x09, 0x1E, //  192 <> 
+4, /*N*/ 0x1F, 0x15, 0x15, 0x1D, //  193 <> 
+4, /*N*/ 0x1F, 0x15, 0x15, 0x0A, //  194 <> 
+4, /*N*/ 0x1F, 0x01, 0x01, 0x03, //  195 <> 
+4, /*N*/ 0x18, 0x0F, 0x09, 0x1F, //  196 <> 
+4, /*N*/ 0x1F, 0x15, 0x15, 0x11, //  197 <> 
+4, /*N*/ 0x1B, 0x0E, 0x1F, 0x0E, //  198 <> 
+4, /*N*/ 0x11, 0x15, 0x15, 0x1F, //  199 <> 
+4, /*N*/ 0x1F, 0x08, 0x04, 0x1F, //  200 <> 
+4, /*N*/ 0x1E, 0x09, 0x05, 0x1E, //  201 <> 
+4, /*N*/ 0x1F, 0x04, 0x06, 0x19, //  202 <> 
+4, /*N*/ 0x10, 0x1F, 0x01, 0x1F, //  203 <> 
+4, /*N*/ 0x1F, 0x02, 0x02, 0x1F, //  204 <> 
+4, /*N*/ 0x1F, 0x04, 0x04, 0x1F, //  205 <> 
+4, /*N*/ 0x0E, 0x11, 0x11, 0x0E, //  206 <> 
+4, /*N*/ 0x1F, 0x01, 0x01, 0x1F, //  207 <> 
+4, /*N*/ 0x1F, 0x05, 0x05, 0x07, //  208 <> 
+4, /*N*/ 0x0E, 0x11, 0x11, 0x11, //  209 <> 
+3, /*N*/ 0x01, 0x1F, 0x01, 0x00, //  210 <> 
+4, /*N*/ 0x13, 0x14, 0x14, 0x0F, //  211 <> 
+4, /*N*/ 0x0F, 0x09, 0x1F, 0x09, //  212 <> 
+4, /*N*/ 0x1B, 0x04, 0x04, 0x1B, //  213 <> 
+4, /*N*/ 0x0F, 0x08, 0x08, 0x1F, //  214 <> 
+4, /*N*/ 0x07, 0x04, 0x04, 0x1F, //  215 <> 
+4, /*N*/ 0x1F, 0x08, 0x08, 0x1F, //  216 <> 
+4, /*N*/ 0x1F, 0x08, 0x18, 0x1F, //  217 <> 
+4, /*N*/ 0x01, 0x1F, 0x14, 0x1C, //  218 <> 
+4, /*N*/ 0x1F, 0x14, 0x08, 0x1F, //  219 <> 
+3, /*N*/ 0x1F, 0x14, 0x1C, 0x00, //  220 <> 
+3, /*N*/ 0x11, 0x15, 0x0E, 0x00, //  221 <> 
+4, /*N*/ 0x1F, 0x04, 0x1F, 0x11, //  222 <> 
+4, /*N*/ 0x12, 0x0D, 0x05, 0x1F, //  223 <> 
+
+  // Cyrillic Smalls / ,  
+4, /*N*/ 0x1C, 0x0A, 0x0A, 0x1C, //  224 <> 
+4, /*N*/ 0x1E, 0x15, 0x15, 0x09, //  225 <> 
+3, /*N*/ 0x1E, 0x15, 0x0A, 0x00, //  226 <> 
+3, /*N*/ 0x1E, 0x02, 0x02, 0x00, //  227 <> 
+4, /*N*/ 0x18, 0x0E, 0x0A, 0x1E, //  228 <> 
+3, /*N*/ 0x0C, 0x1A, 0x16, 0x00, //  229 <> 
+4, /*N*/ 0x1A, 0x0C, 0x1E, 0x0C, //  230 <> 
+3, /*N*/ 0x12, 0x16, 0x1A, 0x00, //  231 <> 
+4, /*N*/ 0x1E, 0x08, 0x04, 0x1E, //  232 <> 
+4, /*N*/ 0x1E, 0x08, 0x05, 0x1E, //  233 <> 
+4, /*N*/ 0x1F, 0x04, 0x0A, 0x10, //  234 <> 
+4, /*N*/ 0x10, 0x0C, 0x02, 0x1E, //  235 <> 
+4, /*N*/ 0x1E, 0x04, 0x04, 0x1E, //  236 <> 
+4, /*N*/ 0x1E, 0x04, 0x04, 0x1E, //  237 <> 
+4, /*N*/ 0x0C, 0x12, 0x12, 0x0C, //  238 <> 
+4, /*N*/ 0x1E, 0x02, 0x02, 0x1E, //  239 <> 
+4, /*N*/ 0x1E, 0x0A, 0x0A, 0x04, //  240 <> 
+3, /*N*/ 0x0C, 0x12, 0x12, 0x00, //  241 <> 
+3, /*N*/ 0x02, 0x1E, 0x02, 0x00, //  242 <> 
+4, /*N*/ 0x16, 0x18, 0x08, 0x06, //  243 <> 
+4, /*N*/ 0x0E, 0x0A, 0x1F, 0x0A, //  244 <> 
+3, /*N*/ 0x12, 0x0C, 0x12, 0x00, //  245 <> 
+4, /*N*/ 0x1E, 0x10, 0x1E, 0x10, //  246 <> 
+4, /*N*/ 0x06, 0x08, 0x08, 0x1E, //  247 <> 
+4, /*N*/ 0x1E, 0x08, 0x08, 0x1E, //  248 <> 
+4, /*N*/ 0x1E, 0x08, 0x18, 0x1E, //  249 <> 
+4, /*N*/ 0x02, 0x1E, 0x14, 0x1C, //  250 <> 
+4, /*N*/ 0x1E, 0x14, 0x08, 0x1E, //  251 <> 
+3, /*N*/ 0x1E, 0x14, 0x1C, 0x00, //  252 <> 
+3, /*N*/ 0x12, 0x16, 0x0E, 0x00, //  253 <> 
+4, /*N*/ 0x1E, 0x0C, 0x12, 0x0C, //  254 <> 
+4, /*N*/ 0x14, 0x0A, 0x0A, 0x1E  //  255 <> 
+};
+
+#define FONT_EXTRA_5_LENGTH     6
+
+constexpr uint16_t font_extra_5_cps[FONT_EXTRA_5_LENGTH] = {0x00B0, 0x00B1, 0x2190, 0x2191, 0x2192, 0x2193};
+
+constexpr unsigned char  font_extra_5[FONT_EXTRA_5_LENGTH * (1 + FONT_5_CHAR_WIDTH)] =
+{
+  3, /*N*/ 0x02, 0x05, 0x02, 0x00, // Symbol U+00B0 (degree)
+  3, /*N*/ 0x12, 0x17, 0x12, 0x00, // Symbol U+00B1 (plus-minus)
+  4, /*N*/ 0x04, 0x0E, 0x15, 0x04, // Symbol U+2190 (left arrow)
+  3, /*N*/ 0x02, 0x1F, 0x02, 0x00, // Symbol U+2191 (up arrow)
+  4, /*N*/ 0x04, 0x15, 0x0E, 0x04, // Symbol U+2192 (right arrow)
+  3, /*N*/ 0x08, 0x1F, 0x08, 0x00, // Symbol U+2193 (down arrow)
+};
+
+
+
+
+
+//################################### FONT 8 ###################################//
+
+#define FONT_8_CHAR_WIDTH       5
+#define FONT_8_CHAR_HEIGHT      8
+#define FONT_8_CHAR_INTERVAL    1
+
+#define FONT_EN_8_LENGTH        95
+#define FONT_EN_8_START_CHAR    32
+#define FONT_EN_8_ARRAY_LENGTH  (FONT_EN_8_LENGTH * (1 + FONT_8_CHAR_WIDTH))
+
+#define FONT_RU_8_LENGTH        64
+#define FONT_RU_8_START_CHAR    192
+#define FONT_RU_8_ARRAY_LENGTH  (FONT_RU_8_LENGTH * (1 + FONT_8_CHAR_WIDTH))
+
+
+constexpr unsigned char  font_en_8[FONT_EN_8_ARRAY_LENGTH] =
+{
+3, /*N*/ 0x00, 0x00, 0x00, 0x00, 0x00, //  32  < > 
+      1, /*N*/ 0x5F, 0x00, 0x00, 0x00, 0x00, //  33  <!> 
+      3, /*N*/ 0x03, 0x00, 0x03, 0x00, 0x00, //  34  <"> 
+      5, /*N*/ 0x14, 0x7F, 0x14, 0x7F, 0x14, //  35  <#> 
+      5, /*N*/ 0x24, 0x2A, 0x7F, 0x2A, 0x12, //  36  <$> 
+      5, /*N*/ 0x46, 0x26, 0x10, 0xC8, 0xC4, //  37  <%> 
+      5, /*N*/ 0x36, 0x49, 0x55, 0x22, 0x50, //  38  <&> 
+      1, /*N*/ 0x03, 0x00, 0x00, 0x00, 0x00, //  39  <'> 
+      3, /*N*/ 0x1C, 0x22, 0x41, 0x00, 0x00, //  40  <(> 
+      3, /*N*/ 0x41, 0x22, 0x1C, 0x00, 0x00, //  41  <)> 
+      5, /*N*/ 0x14, 0x08, 0x3E, 0x08, 0x14, //  42  <*> 
+      5, /*N*/ 0x08, 0x08, 0x3E, 0x08, 0x08, //  43  <+> 
+      2, /*N*/ 0xA0, 0x60, 0x00, 0x00, 0x00, //  44  <,> 
+      5, /*N*/ 0x08, 0x08, 0x08, 0x08, 0x08, //  45  <-> 
+      2, /*N*/ 0x60, 0x60, 0x00, 0x00, 0x00, //  46  <.> 
+      4, /*N*/ 0xC0, 0x30, 0x0C, 0x03, 0x00, //  47  </> 
+
+        // Digits /  
+      5, /*N*/ 0x3E, 0x51, 0x49, 0x45, 0x3E, //  48  <0> 
+      3, /*N*/ 0x42, 0x7F, 0x40, 0x00, 0x00, //  49  <1> 
+      5, /*N*/ 0x42, 0x61, 0x51, 0x49, 0x46, //  50  <2> 
+      5, /*N*/ 0x21, 0x41, 0x45, 0x4B, 0x31, //  51  <3> 
+      5, /*N*/ 0x18, 0x14, 0x12, 0x7F, 0x10, //  52  <4> 
+      5, /*N*/ 0x27, 0x45, 0x45, 0x45, 0x39, //  53  <5> 
+      5, /*N*/ 0x3C, 0x4A, 0x49, 0x49, 0x30, //  54  <6> 
+      5, /*N*/ 0x01, 0x71, 0x09, 0x05, 0x03, //  55  <7> 
+      5, /*N*/ 0x36, 0x49, 0x49, 0x49, 0x36, //  56  <8> 
+      5, /*N*/ 0x06, 0x49, 0x49, 0x29, 0x1E, //  57  <9> 
+
+      2, /*N*/ 0x66, 0x66, 0x00, 0x00, 0x00, //  58  <:> 
+      2, /*N*/ 0xA6, 0x66, 0x00, 0x00, 0x00, //  59  <;> 
+      4, /*N*/ 0x08, 0x14, 0x22, 0x41, 0x00, //  60  <<> 
+      5, /*N*/ 0x14, 0x14, 0x14, 0x14, 0x14, //  61  <=> 
+      4, /*N*/ 0x41, 0x22, 0x14, 0x08, 0x00, //  62  <>> 
+      5, /*N*/ 0x02, 0x01, 0x51, 0x09, 0x06, //  63  <?> 
+      5, /*N*/ 0x3E, 0x41, 0x5D, 0x55, 0x1E, //  64  <@> 
+
+        // Roman Capitals / ,  
+      5, /*N*/ 0x7E, 0x11, 0x11, 0x11, 0x7E, //  65  <A> 
+      5, /*N*/ 0x7F, 0x49, 0x49, 0x49, 0x36, //  66  <B> 
+      5, /*N*/ 0x3E, 0x41, 0x41, 0x41, 0x22, //  67  <C> 
+      5, /*N*/ 0x7F, 0x41, 0x41, 0x41, 0x3E, //  68  <D> 
+      5, /*N*/ 0x7F, 0x49, 0x49, 0x49, 0x41, //  69  <E> 
+      5, /*N*/ 0x7F, 0x09, 0x09, 0x09, 0x01, //  70  <F> 
+      5, /*N*/ 0x3E, 0x41, 0x49, 0x49, 0x7A, //  71  <G> 
+      5, /*N*/ 0x7F, 0x08, 0x08, 0x08, 0x7F, //  72  <H> 
+      3, /*N*/ 0x41, 0x7F, 0x41, 0x00, 0x00, //  73  <I> 
+      5, /*N*/ 0x20, 0x40, 0x41, 0x3F, 0x01, //  74  <J> 
+      5, /*N*/ 0x7F, 0x08, 0x14, 0x22, 0x41, //  75  <K> 
+      5, /*N*/ 0x7F, 0x40, 0x40, 0x40, 0x40, //  76  <L> 
+      5, /*N*/ 0x7F, 0x02, 0x0C, 0x02, 0x7F, //  77  <M> 
+      5, /*N*/ 0x7F, 0x04, 0x08, 0x10, 0x7F, //  78  <N> 
+      5, /*N*/ 0x3E, 0x41, 0x41, 0x41, 0x3E, //  79  <O> 
+      5, /*N*/ 0x7F, 0x11, 0x11, 0x11, 0x0E, //  80  <P> 
+      5, /*N*/ 0x3E, 0x41, 0x51, 0x21, 0x5E, //  81  <Q> 
+      5, /*N*/ 0x7F, 0x09, 0x19, 0x29, 0x46, //  82  <R> 
+      5, /*N*/ 0x26, 0x49, 0x49, 0x49, 0x32, //  83  <S> 
+      5, /*N*/ 0x01, 0x01, 0x7F, 0x01, 0x01, //  84  <T> 
+      5, /*N*/ 0x3F, 0x40, 0x40, 0x40, 0x3F, //  85  <U> 
+      5, /*N*/ 0x1F, 0x20, 0x40, 0x20, 0x1F, //  86  <V> 
+      5, /*N*/ 0x3F, 0x40, 0x38, 0x40, 0x3F, //  87  <W> 
+      5, /*N*/ 0x63, 0x14, 0x08, 0x14, 0x63, //  88  <X> 
+      5, /*N*/ 0x07, 0x08, 0x70, 0x08, 0x07, //  89  <Y> 
+      5, /*N*/ 0x61, 0x51, 0x49, 0x45, 0x43, //  90  <Z> 
+
+      2, /*N*/ 0x7F, 0x41, 0x00, 0x00, 0x00, //  91  <[> 
+      4, /*N*/ 0x03, 0x0C, 0x30, 0xC0, 0x00, //  92  <\> 
+      2, /*N*/ 0x41, 0x7F, 0x00, 0x00, 0x00, //  93  <]> 
+      5, /*N*/ 0x04, 0x02, 0x01, 0x02, 0x04, //  94  <^> 
+      5, /*N*/ 0x80, 0x80, 0x80, 0x80, 0x80, //  95  <_> 
+      2, /*N*/ 0x01, 0x02, 0x00, 0x00, 0x00, //  96  <`> 
+
+        // Roman Smalls / ,  
+      5, /*N*/ 0x20, 0x54, 0x54, 0x54, 0x78, //  97  <a> 
+      5, /*N*/ 0x7F, 0x48, 0x44, 0x44, 0x38, //  98  <b> 
+      4, /*N*/ 0x38, 0x44, 0x44, 0x44, 0x00, //  99  <c> 
+      5, /*N*/ 0x38, 0x44, 0x44, 0x48, 0x7F, //  100 <d> 
+      5, /*N*/ 0x38, 0x54, 0x54, 0x54, 0x18, //  101 <e> 
+      5, /*N*/ 0x08, 0x7E, 0x09, 0x01, 0x02, //  102 <f> 
+      5, /*N*/ 0x4C, 0x92, 0x92, 0x8A, 0x7C, //  103 <g> 
+      5, /*N*/ 0x7F, 0x08, 0x04, 0x04, 0x78, //  104 <h> 
+      3, /*N*/ 0x44, 0x7D, 0x40, 0x00, 0x00, //  105 <i> 
+      4, /*N*/ 0x20, 0x40, 0x44, 0x3D, 0x00, //  106 <j> 
+      4, /*N*/ 0x7F, 0x10, 0x28, 0x44, 0x00, //  107 <k> 
+      3, /*N*/ 0x41, 0x7F, 0x40, 0x00, 0x00, //  108 <l> 
+      5, /*N*/ 0x7C, 0x04, 0x18, 0x04, 0x78, //  109 <m> 
+      5, /*N*/ 0x7C, 0x08, 0x04, 0x04, 0x78, //  110 <n> 
+      5, /*N*/ 0x38, 0x44, 0x44, 0x44, 0x38, //  111 <o> 
+      5, /*N*/ 0x7C, 0x14, 0x14, 0x14, 0x08, //  112 <p> 
+      4, /*N*/ 0x1C, 0x22, 0x22, 0xFC, 0x00, //  113 <q> 
+      5, /*N*/ 0x7C, 0x08, 0x04, 0x04, 0x08, //  114 <r> 
+      4, /*N*/ 0x48, 0x54, 0x54, 0x24, 0x00, //  115 <s> 
+      5, /*N*/ 0x04, 0x3F, 0x44, 0x40, 0x20, //  116 <t> 
+      5, /*N*/ 0x3C, 0x40, 0x40, 0x20, 0x7C, //  117 <u> 
+      5, /*N*/ 0x1C, 0x20, 0x40, 0x20, 0x1C, //  118 <v> 
+      5, /*N*/ 0x3C, 0x40, 0x30, 0x40, 0x3C, //  119 <w> 
+      5, /*N*/ 0x44, 0x28, 0x10, 0x28, 0x44, //  120 <x> 
+      5, /*N*/ 0x0C, 0x50, 0x50, 0x50, 0x3C, //  121 <y> 
+      5, /*N*/ 0x44, 0x64, 0x54, 0x4C, 0x44, //  122 <z> 
+
+      3, /*N*/ 0x08, 0x36, 0x41, 0x00, 0x00, //  123 <{> 
+      1, /*N*/ 0x7F, 0x00, 0x00, 0x00, 0x00, //  124 <|> 
+      3, /*N*/ 0x41, 0x36, 0x08, 0x00, 0x00, //  125 <}> 
+      5, /*N*/ 0x08, 0x04, 0x08, 0x10, 0x08  //  126 <~>  
+};
+
+
+constexpr unsigned char  font_ru_8[FONT_RU_8_ARRAY_LENGTH] =
+{
+
+      // Cyrillic Capitals / ,  
+      5, /*N*/ 0x7E, 0x11, 0x11, 0x11, 0x7E, //  192 <> 
+      5, /*N*/ 0x7F, 0x49, 0x49, 0x49, 0x33, //  193 <> 
+      5, /*N*/ 0x7F, 0x49, 0x49, 0x49, 0x36, //  194 <> 
+      5, /*N*/ 0x7F, 0x01, 0x01, 0x01, 0x03, //  195 <> 
+      5, /*N*/ 0xE0, 0x51, 0x4F, 0x41, 0xFF, //  196 <> 
+      5, /*N*/ 0x7F, 0x49, 0x49, 0x49, 0x41, //  197 <> 
+      5, /*N*/ 0x77, 0x08, 0x7F, 0x08, 0x77, //  198 <> 
+      5, /*N*/ 0x41, 0x49, 0x49, 0x49, 0x36, //  199 <> 
+      5, /*N*/ 0x7F, 0x10, 0x08, 0x04, 0x7F, //  200 <> 
+      5, /*N*/ 0x7C, 0x21, 0x12, 0x09, 0x7C, //  201 <> 
+      5, /*N*/ 0x7F, 0x08, 0x14, 0x22, 0x41, //  202 <> 
+      5, /*N*/ 0x20, 0x41, 0x3F, 0x01, 0x7F, //  203 <> 
+      5, /*N*/ 0x7F, 0x02, 0x0C, 0x02, 0x7F, //  204 <> 
+      5, /*N*/ 0x7F, 0x08, 0x08, 0x08, 0x7F, //  205 <> 
+      5, /*N*/ 0x3E, 0x41, 0x41, 0x41, 0x3E, //  206 <> 
+      5, /*N*/ 0x7F, 0x01, 0x01, 0x01, 0x7F, //  207 <> 
+      5, /*N*/ 0x7F, 0x09, 0x09, 0x09, 0x06, //  208 <> 
+      5, /*N*/ 0x3E, 0x41, 0x41, 0x41, 0x22, //  209 <> 
+      5, /*N*/ 0x01, 0x01, 0x7F, 0x01, 0x01, //  210 <> 
+      5, /*N*/ 0x47, 0x28, 0x10, 0x08, 0x07, //  211 <> 
+      5, /*N*/ 0x1C, 0x22, 0x7F, 0x22, 0x1C, //  212 <> 
+      5, /*N*/ 0x63, 0x14, 0x08, 0x14, 0x63, //  213 <> 
+      5, /*N*/ 0x7F, 0x40, 0x40, 0x40, 0xFF, //  214 <> 
+      5, /*N*/ 0x07, 0x08, 0x08, 0x08, 0x7F, //  215 <> 
+      5, /*N*/ 0x7F, 0x40, 0x7F, 0x40, 0x7F, //  216 <> 
+      5, /*N*/ 0x7F, 0x40, 0x7F, 0x40, 0xFF, //  217 <> 
+      5, /*N*/ 0x01, 0x7F, 0x48, 0x48, 0x30, //  218 <> 
+      5, /*N*/ 0x7F, 0x48, 0x30, 0x00, 0x7F, //  219 <> 
+      4, /*N*/ 0x7F, 0x48, 0x48, 0x30, 0x00, //  220 <> 
+      5, /*N*/ 0x41, 0x49, 0x49, 0x2A, 0x1C, //  221 <> 
+      5, /*N*/ 0x7F, 0x08, 0x3E, 0x41, 0x3E, //  222 <> 
+      5, /*N*/ 0x46, 0x29, 0x19, 0x09, 0x7F, //  223 <> 
+
+        // Cyrillic Smalls / ,  
+      5, /*N*/ 0x20, 0x54, 0x54, 0x54, 0x78, //  224 <> 
+      5, /*N*/ 0x3C, 0x4A, 0x4A, 0x49, 0x31, //  225 <> 
+      4, /*N*/ 0x7C, 0x54, 0x54, 0x28, 0x00, //  226 <> 
+      4, /*N*/ 0x7C, 0x04, 0x04, 0x04, 0x00, //  227 <> 
+      5, /*N*/ 0xE0, 0x54, 0x4C, 0x44, 0xFC, //  228 <> 
+      5, /*N*/ 0x38, 0x54, 0x54, 0x54, 0x18, //  229 <> 
+      5, /*N*/ 0x6C, 0x10, 0x7C, 0x10, 0x6C, //  230 <> 
+      4, /*N*/ 0x44, 0x54, 0x54, 0x28, 0x00, //  231 <> 
+      5, /*N*/ 0x7C, 0x20, 0x10, 0x08, 0x7C, //  232 <> 
+      5, /*N*/ 0x78, 0x42, 0x24, 0x12, 0x78, //  233 <> 
+      4, /*N*/ 0x7C, 0x10, 0x28, 0x44, 0x00, //  234 <> 
+      4, /*N*/ 0x40, 0x38, 0x04, 0x7C, 0x00, //  235 <> 
+      5, /*N*/ 0x7C, 0x08, 0x10, 0x08, 0x7C, //  236 <> 
+      4, /*N*/ 0x7C, 0x10, 0x10, 0x7C, 0x00, //  237 <> 
+      4, /*N*/ 0x38, 0x44, 0x44, 0x38, 0x00, //  238 <> 
+      4, /*N*/ 0x7C, 0x04, 0x04, 0x7C, 0x00, //  239 <> 
+      4, /*N*/ 0xFC, 0x24, 0x24, 0x18, 0x00, //  240 <> 
+      4, /*N*/ 0x38, 0x44, 0x44, 0x44, 0x00, //  241 <> 
+      5, /*N*/ 0x04, 0x04, 0x7C, 0x04, 0x04, //  242 <> 
+      4, /*N*/ 0x9C, 0xA0, 0xA0, 0x7C, 0x00, //  243 <> 
+      5, /*N*/ 0x38, 0x44, 0xFE, 0x44, 0x38, //  244 <> 
+      5, /*N*/ 0x44, 0x28, 0x10, 0x28, 0x44, //  245 <> 
+      4, /*N*/ 0x7C, 0x40, 0x40, 0xFC, 0x00, //  246 <> 
+      4, /*N*/ 0x0C, 0x10, 0x10, 0x7C, 0x00, //  247 <> 
+      5, /*N*/ 0x7C, 0x40, 0x7C, 0x40, 0x7C, //  248 <> 
+      5, /*N*/ 0x7C, 0x40, 0x7C, 0x40, 0xFC, //  249 <> 
+      5, /*N*/ 0x04, 0x7C, 0x50, 0x50, 0x20, //  250 <> 
+      5, /*N*/ 0x7C, 0x50, 0x20, 0x00, 0x7C, //  251 <> 
+      4, /*N*/ 0x7C, 0x50, 0x50, 0x20, 0x00, //  252 <> 
+      4, /*N*/ 0x44, 0x54, 0x54, 0x38, 0x00, //  253 <> 
+      5, /*N*/ 0x7C, 0x10, 0x38, 0x44, 0x38, //  254 <> 
+      4, /*N*/ 0x48, 0x34, 0x14, 0x7C, 0x00  //  255 <> 
+};
+
+#define FONT_EXTRA_8_LENGTH     7
+
+constexpr uint16_t font_extra_8_cps[FONT_EXTRA_8_LENGTH] = {0x00B0, 0x00B1, 0x00B5, 0x2190, 0x2191, 0x2192, 0x2193};
+
+constexpr unsigned char  font_extra_8[FONT_EXTRA_8_LENGTH * (1 + FONT_8_CHAR_WIDTH)] =
+{
+      3, /*N*/ 0x02, 0x05, 0x02, 0x00, 0x00, // Symbol U+00B0 (degree)
+      5, /*N*/ 0x48, 0x48, 0x5E, 0x48, 0x48, // Symbol U+00B1 (plus-minus)
+      5, /*N*/ 0xFC, 0x40, 0x40, 0x20, 0x7C, // Symbol U+00B5 (micro)
+      5, /*N*/ 0x08, 0x1C, 0x2A, 0x08, 0x08, // Symbol U+2190 (left arrow)
+      5, /*N*/ 0x04, 0x02, 0x7F, 0x02, 0x04, // Symbol U+2191 (up arrow)
+      5, /*N*/ 0x08, 0x08, 0x2A, 0x1C, 0x08, // Symbol U+2192 (right arrow)
+      5, /*N*/ 0x10, 0x20, 0x7F, 0x20, 0x10, // Symbol U+2193 (down arrow)
+};
+
+
+
+
+
+//################################### FONT 16 ###################################//
+
+#define FONT_16_CHAR_WIDTH       10
+#define FONT_16_CHAR_HEIGHT      16
+#define FONT_16_CHAR_INTERVAL    2
+
+#define FONT_EN_16_LENGTH           95
+#define FONT_EN_16_START_CHAR       32
+#define FONT_EN_16_ARRAY_LENGTH     (FONT_EN_16_LENGTH * (1 + FONT_16_CHAR_WIDTH))
+
+
+#define FONT_RU_16_LENGTH           64
+#define FONT_RU_16_START_CHAR       192
+#define FONT_RU_16_ARRAY_LENGTH     (FONT_RU_16_LENGTH * (1 + FONT_16_CHAR_WIDTH))
+
+
+constexpr unsigned short font_en_16[FONT_EN_16_ARRAY_LENGTH] =
+{
+        6, /*N*/ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  32  < > 
+        2, /*N*/ 0x0CFF, 0x0CFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  33  <!> 
+        5, /*N*/ 0x0007, 0x0007, 0x0000, 0x0007, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  34  <"> 
+        8, /*N*/ 0x030C, 0x0FFF, 0x0FFF, 0x030C, 0x030C, 0x0FFF, 0x0FFF, 0x030C, 0x0000, 0x0000, //  35  <#> 
+        8, /*N*/ 0x033C, 0x073E, 0x0666, 0x0FFF, 0x0FFF, 0x0666, 0x07E6, 0x03CC, 0x0000, 0x0000, //  36  <$> 
+        7, /*N*/ 0x0C07, 0x0F07, 0x03C7, 0x00F0, 0x0E3C, 0x0E0F, 0x0E03, 0x0000, 0x0000, 0x0000, //  37  <%> 
+        9, /*N*/ 0x0780, 0x0FCE, 0x0C7F, 0x0C71, 0x0CF9, 0x078F, 0x0706, 0x0D80, 0x0CC0, 0x0000, //  38  <&> 
+        2, /*N*/ 0x0007, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  39  <'> 
+        3, /*N*/ 0x07FE, 0x0FFF, 0x0C03, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  40  <(> 
+        3, /*N*/ 0x0C03, 0x0FFF, 0x07FE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  41  <)> 
+        8, /*N*/ 0x0198, 0x01F8, 0x00F0, 0x03FC, 0x03FC, 0x00F0, 0x01F8, 0x0198, 0x0000, 0x0000, //  42  <*> 
+        8, /*N*/ 0x0060, 0x0060, 0x0060, 0x03FC, 0x03FC, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, //  43  <+> 
+        3, /*N*/ 0x3000, 0x3C00, 0x1C00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  44  <,> 
+        8, /*N*/ 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, //  45  <-> 
+        2, /*N*/ 0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  46  <.> 
+        7, /*N*/ 0x0C00, 0x0F00, 0x03C0, 0x00F0, 0x003C, 0x000F, 0x0003, 0x0000, 0x0000, 0x0000, //  47  </> 
+
+        // Digits /  
+        8, /*N*/ 0x07FE, 0x0FFF, 0x0D83, 0x0CC3, 0x0C63, 0x0C33, 0x0FFF, 0x07FE, 0x0000, 0x0000, //  48  <0> 
+        8, /*N*/ 0x0C18, 0x0C1C, 0x0C0E, 0x0FFF, 0x0FFF, 0x0C00, 0x0C00, 0x0C00, 0x0000, 0x0000, //  49  <1> 
+        8, /*N*/ 0x0FC6, 0x0FE7, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0C7F, 0x0C3E, 0x0000, 0x0000, //  50  <2> 
+        8, /*N*/ 0x0606, 0x0E07, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0FFF, 0x079E, 0x0000, 0x0000, //  51  <3> 
+        8, /*N*/ 0x00E0, 0x01F0, 0x01B8, 0x019C, 0x018E, 0x0FFF, 0x0FFF, 0x0180, 0x0000, 0x0000, //  52  <4> 
+        8, /*N*/ 0x063F, 0x0E3F, 0x0C33, 0x0C33, 0x0C33, 0x0C33, 0x0FF3, 0x07E3, 0x0000, 0x0000, //  53  <5> 
+        8, /*N*/ 0x07FE, 0x0FFF, 0x0C33, 0x0C33, 0x0C33, 0x0C33, 0x0FF7, 0x07E6, 0x0000, 0x0000, //  54  <6> 
+        8, /*N*/ 0x0003, 0x0003, 0x0E03, 0x0F83, 0x01E3, 0x007B, 0x001F, 0x0007, 0x0000, 0x0000, //  55  <7> 
+        8, /*N*/ 0x079E, 0x0FFF, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0FFF, 0x079E, 0x0000, 0x0000, //  56  <8> 
+        8, /*N*/ 0x063E, 0x0E7F, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0FFF, 0x07FE, 0x0000, 0x0000, //  57  <9> 
+
+        2, /*N*/ 0x0306, 0x0306, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  58  <:> 
+        3, /*N*/ 0x0600, 0x0706, 0x0306, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  59  <;> 
+        6, /*N*/ 0x0060, 0x00F0, 0x0198, 0x030C, 0x0606, 0x0C03, 0x0000, 0x0000, 0x0000, 0x0000, //  60  <<> 
+        8, /*N*/ 0x01B0, 0x01B0, 0x01B0, 0x01B0, 0x01B0, 0x01B0, 0x01B0, 0x01B0, 0x0000, 0x0000, //  61  <=> 
+        6, /*N*/ 0x0C03, 0x0606, 0x030C, 0x0198, 0x00F0, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, //  62  <>> 
+        8, /*N*/ 0x0006, 0x0007, 0x0003, 0x0DC3, 0x0DE3, 0x0063, 0x003F, 0x001E, 0x0000, 0x0000, //  63  <?> 
+        8, /*N*/ 0x07FE, 0x0FFF, 0x0C03, 0x0CF3, 0x0DFB, 0x0D8B, 0x0DFF, 0x04FE, 0x0000, 0x0000, //  64  <@> 
+
+        // Roman Capitals / ,  
+        8, /*N*/ 0x0FFE, 0x0FFF, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x0FFF, 0x0FFE, 0x0000, 0x0000, //  65  <A> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0FFF, 0x079E, 0x0000, 0x0000, //  66  <B> 
+        8, /*N*/ 0x07FE, 0x0FFF, 0x0C03, 0x0C03, 0x0C03, 0x0C03, 0x0E07, 0x0606, 0x0000, 0x0000, //  67  <C> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x0C03, 0x0C03, 0x0C03, 0x0E07, 0x07FE, 0x03FC, 0x0000, 0x0000, //  68  <D> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0C03, 0x0C03, 0x0000, 0x0000, //  69  <E> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x0063, 0x0063, 0x0063, 0x0063, 0x0003, 0x0003, 0x0000, 0x0000, //  70  <F> 
+        8, /*N*/ 0x07FE, 0x0FFF, 0x0C03, 0x0C03, 0x0CC3, 0x0CC3, 0x0FC7, 0x07C6, 0x0000, 0x0000, //  71  <G> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x0060, 0x0060, 0x0060, 0x0060, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  72  <H> 
+        8, /*N*/ 0x0C03, 0x0C03, 0x0C03, 0x0FFF, 0x0FFF, 0x0C03, 0x0C03, 0x0C03, 0x0000, 0x0000, //  73  <I> 
+        8, /*N*/ 0x0600, 0x0E00, 0x0C00, 0x0C00, 0x0C03, 0x0FFF, 0x07FF, 0x0003, 0x0000, 0x0000, //  74  <J> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x0070, 0x00F8, 0x01DC, 0x038E, 0x0F07, 0x0E03, 0x0000, 0x0000, //  75  <K> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0E00, 0x0E00, 0x0000, 0x0000, //  76  <L> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x000E, 0x001C, 0x001C, 0x000E, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  77  <M> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x001C, 0x0038, 0x0070, 0x00E0, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  78  <N> 
+        8, /*N*/ 0x07FE, 0x0FFF, 0x0C03, 0x0C03, 0x0C03, 0x0C03, 0x0FFF, 0x07FE, 0x0000, 0x0000, //  79  <O> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00FF, 0x007E, 0x0000, 0x0000, //  80  <P> 
+        9, /*N*/ 0x07FE, 0x0FFF, 0x0C03, 0x0C03, 0x0D83, 0x0783, 0x07FF, 0x0FFE, 0x0C00, 0x0000, //  81  <Q> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x00E3, 0x01E3, 0x03E3, 0x0763, 0x0E7F, 0x0C3E, 0x0000, 0x0000, //  82  <R> 
+        8, /*N*/ 0x063E, 0x0E7F, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0FE7, 0x07C6, 0x0000, 0x0000, //  83  <S> 
+        8, /*N*/ 0x0003, 0x0003, 0x0003, 0x0FFF, 0x0FFF, 0x0003, 0x0003, 0x0003, 0x0000, 0x0000, //  84  <T> 
+        8, /*N*/ 0x07FF, 0x0FFF, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0FFF, 0x07FF, 0x0000, 0x0000, //  85  <U> 
+        8, /*N*/ 0x01FF, 0x03FF, 0x0700, 0x0E00, 0x0E00, 0x0700, 0x03FF, 0x01FF, 0x0000, 0x0000, //  86  <V> 
+       10, /*N*/ 0x07FF, 0x0FFF, 0x0C00, 0x0C00, 0x07FE, 0x07FE, 0x0C00, 0x0C00, 0x0FFF, 0x07FF, //  87  <W> 
+        8, /*N*/ 0x0F0F, 0x0F9F, 0x01F8, 0x00F0, 0x00F0, 0x01F8, 0x0F9F, 0x0F0F, 0x0000, 0x0000, //  88  <X> 
+        8, /*N*/ 0x0007, 0x001F, 0x0038, 0x0FF0, 0x0FF0, 0x0038, 0x001F, 0x0007, 0x0000, 0x0000, //  89  <Y> 
+        8, /*N*/ 0x0F07, 0x0F87, 0x0DC3, 0x0CE3, 0x0C73, 0x0C3B, 0x0E1F, 0x0E0F, 0x0000, 0x0000, //  90  <Z> 
+
+        4, /*N*/ 0x0FFF, 0x0FFF, 0x0C03, 0x0C03, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  91  <[> 
+        7, /*N*/ 0x0003, 0x000F, 0x003C, 0x00F0, 0x03C0, 0x0F00, 0x0C00, 0x0000, 0x0000, 0x0000, //  92  <\> 
+        4, /*N*/ 0x0C03, 0x0C03, 0x0FFF, 0x0FFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  93  <]> 
+        8, /*N*/ 0x0018, 0x000C, 0x0006, 0x0003, 0x0003, 0x0006, 0x000C, 0x0018, 0x0000, 0x0000, //  94  <^> 
+        8, /*N*/ 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0000, 0x0000, //  95  <_> 
+        4, /*N*/ 0x0001, 0x0003, 0x0006, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  96  <`> 
+
+        // Roman Smalls / ,  
+        7, /*N*/ 0x0730, 0x0FB0, 0x0DB0, 0x0DB0, 0x0DB0, 0x0FF0, 0x0FE0, 0x0000, 0x0000, 0x0000, //  97  <a> 
+        7, /*N*/ 0x0FFF, 0x0FFF, 0x0C30, 0x0C30, 0x0C30, 0x0FF0, 0x07C0, 0x0000, 0x0000, 0x0000, //  98  <b> 
+        7, /*N*/ 0x07E0, 0x0FF0, 0x0C30, 0x0C30, 0x0C30, 0x0E70, 0x0660, 0x0000, 0x0000, 0x0000, //  99  <c> 
+        7, /*N*/ 0x07E0, 0x0FF0, 0x0C30, 0x0C30, 0x0C30, 0x0FFF, 0x0FFF, 0x0000, 0x0000, 0x0000, //  100 <d> 
+        7, /*N*/ 0x07E0, 0x0FF0, 0x0DB0, 0x0DB0, 0x0DB0, 0x0DF0, 0x05E0, 0x0000, 0x0000, 0x0000, //  101 <e> 
+        7, /*N*/ 0x0030, 0x0FFE, 0x0FFF, 0x0033, 0x0003, 0x0007, 0x0006, 0x0000, 0x0000, 0x0000, //  102 <f> 
+        7, /*N*/ 0x47E0, 0xCFF0, 0xCC30, 0xCC30, 0xCC30, 0xFFF0, 0x7FE0, 0x0000, 0x0000, 0x0000, //  103 <g> 
+        7, /*N*/ 0x0FFF, 0x0FFF, 0x0030, 0x0030, 0x0030, 0x0FF0, 0x0FE0, 0x0000, 0x0000, 0x0000, //  104 <h> 
+        6, /*N*/ 0x0C00, 0x0C10, 0x0FF3, 0x0FF3, 0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000, 0x0000, //  105 <i> 
+        4, /*N*/ 0x6000, 0xC010, 0xFFF3, 0x7FF3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  106 <j> 
+        7, /*N*/ 0x0FFF, 0x0FFF, 0x01C0, 0x03E0, 0x07F0, 0x0E38, 0x0C18, 0x0000, 0x0000, 0x0000, //  107 <k> 
+        6, /*N*/ 0x0C03, 0x0C03, 0x0FFF, 0x0FFF, 0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000, 0x0000, //  108 <l> 
+       10, /*N*/ 0x0FF0, 0x0FF0, 0x0030, 0x0030, 0x0FF0, 0x0FE0, 0x0030, 0x0030, 0x0FF0, 0x0FE0, //  109 <m> 
+        7, /*N*/ 0x0FF0, 0x0FF0, 0x0030, 0x0030, 0x0030, 0x0FF0, 0x0FE0, 0x0000, 0x0000, 0x0000, //  110 <n> 
+        7, /*N*/ 0x07E0, 0x0FF0, 0x0C30, 0x0C30, 0x0C30, 0x0FF0, 0x07E0, 0x0000, 0x0000, 0x0000, //  111 <o> 
+        7, /*N*/ 0xFFF0, 0xFFF0, 0x0C30, 0x0C30, 0x0C30, 0x0FF0, 0x07E0, 0x0000, 0x0000, 0x0000, //  112 <p> 
+        7, /*N*/ 0x07E0, 0x0FF0, 0x0C30, 0x0C30, 0x0C30, 0xFFF0, 0xFFF0, 0x0000, 0x0000, 0x0000, //  113 <q> 
+        7, /*N*/ 0x0FF0, 0x0FF0, 0x0060, 0x0030, 0x0030, 0x0070, 0x0060, 0x0000, 0x0000, 0x0000, //  114 <r> 
+        7, /*N*/ 0x0CE0, 0x0DF0, 0x0DB0, 0x0DB0, 0x0DB0, 0x0FB0, 0x0730, 0x0000, 0x0000, 0x0000, //  115 <s> 
+        7, /*N*/ 0x0030, 0x07FF, 0x0FFF, 0x0C30, 0x0C30, 0x0E00, 0x0600, 0x0000, 0x0000, 0x0000, //  116 <t> 
+        7, /*N*/ 0x07F0, 0x0FF0, 0x0C00, 0x0C00, 0x0C00, 0x0FF0, 0x07F0, 0x0000, 0x0000, 0x0000, //  117 <u> 
+        7, /*N*/ 0x03F0, 0x07F0, 0x0E00, 0x0C00, 0x0E00, 0x07F0, 0x03F0, 0x0000, 0x0000, 0x0000, //  118 <v> 
+        8, /*N*/ 0x07F0, 0x0FF0, 0x0C00, 0x07C0, 0x07C0, 0x0C00, 0x0FF0, 0x07F0, 0x0000, 0x0000, //  119 <w> 
+        7, /*N*/ 0x0C30, 0x0E70, 0x03C0, 0x0180, 0x03C0, 0x0E70, 0x0C30, 0x0000, 0x0000, 0x0000, //  120 <x> 
+        7, /*N*/ 0x07F0, 0xCFF0, 0xCC00, 0xCC00, 0xCC00, 0xFFF0, 0x7FF0, 0x0000, 0x0000, 0x0000, //  121 <y> 
+        7, /*N*/ 0x0C30, 0x0E30, 0x0F30, 0x0DB0, 0x0CF0, 0x0C70, 0x0C30, 0x0000, 0x0000, 0x0000, //  122 <z> 
+
+        4, /*N*/ 0x0060, 0x07FE, 0x0F9F, 0x0C03, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  123 <{> 
+        2, /*N*/ 0x0FFF, 0x0FFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  124 <|> 
+        4, /*N*/ 0x0C03, 0x0F9F, 0x07FE, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  125 <}> 
+        8, /*N*/ 0x0060, 0x0070, 0x0030, 0x0070, 0x00E0, 0x00C0, 0x00E0, 0x0060, 0x0000, 0x0000  //  126 <~> 
+};
+
+
+constexpr unsigned short font_ru_16[FONT_RU_16_ARRAY_LENGTH] =
+{
+        // Cyrillic Capitals / ,  
+        8, /*N*/ 0x0FFC, 0x0FFE, 0x00C7, 0x00C3, 0x00C3, 0x00C7, 0x0FFE, 0x0FFC, 0x0000, 0x0000, //  192 <> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x0C33, 0x0C33, 0x0C33, 0x0C33, 0x0FF3, 0x07E3, 0x0000, 0x0000, //  193 <> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0FFF, 0x079E, 0x0000, 0x0000, //  194 <> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0000, 0x0000, //  195 <> 
+        8, /*N*/ 0x1C00, 0x1FFE, 0x0FFF, 0x0C03, 0x0C03, 0x0FFF, 0x1FFE, 0x1C00, 0x0000, 0x0000, //  196 <> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0C03, 0x0C03, 0x0000, 0x0000, //  197 <> 
+       10, /*N*/ 0x0F0F, 0x0F9F, 0x00F0, 0x0060, 0x0FFF, 0x0FFF, 0x0060, 0x00F0, 0x0F9F, 0x0F0F, //  198 <> 
+        8, /*N*/ 0x0606, 0x0E07, 0x0C03, 0x0C63, 0x0C63, 0x0C63, 0x0FFF, 0x079E, 0x0000, 0x0000, //  199 <> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x00C0, 0x0060, 0x0030, 0x0018, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  200 <> 
+        8, /*N*/ 0x0FF8, 0x0FF8, 0x0301, 0x0182, 0x00C2, 0x0061, 0x0FF8, 0x0FF8, 0x0000, 0x0000, //  201 <> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x00F0, 0x01F8, 0x039C, 0x070E, 0x0E07, 0x0C03, 0x0000, 0x0000, //  202 <> 
+        8, /*N*/ 0x0FFC, 0x0FFE, 0x0007, 0x0003, 0x0003, 0x0003, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  203 <> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x000E, 0x003C, 0x003C, 0x000E, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  204 <> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x0060, 0x0060, 0x0060, 0x0060, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  205 <> 
+        8, /*N*/ 0x07FE, 0x0FFF, 0x0C03, 0x0C03, 0x0C03, 0x0C03, 0x0FFF, 0x07FE, 0x0000, 0x0000, //  206 <> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x0003, 0x0003, 0x0003, 0x0003, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  207 <> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00FF, 0x007E, 0x0000, 0x0000, //  208 <> 
+        8, /*N*/ 0x07FE, 0x0FFF, 0x0C03, 0x0C03, 0x0C03, 0x0C03, 0x0E07, 0x0606, 0x0000, 0x0000, //  209 <> 
+        8, /*N*/ 0x0003, 0x0003, 0x0003, 0x0FFF, 0x0FFF, 0x0003, 0x0003, 0x0003, 0x0000, 0x0000, //  210 <> 
+        8, /*N*/ 0x007F, 0x0CFF, 0x0CC0, 0x0CC0, 0x0CC0, 0x0CC0, 0x0FFF, 0x07FF, 0x0000, 0x0000, //  211 <> 
+       10, /*N*/ 0x01FC, 0x03FE, 0x0306, 0x0306, 0x0FFF, 0x0FFF, 0x0306, 0x0306, 0x03FE, 0x01FC, //  212 <> 
+        8, /*N*/ 0x0E07, 0x0F0F, 0x0198, 0x00F0, 0x00F0, 0x0198, 0x0F0F, 0x0E07, 0x0000, 0x0000, //  213 <> 
+        8, /*N*/ 0x0FFF, 0x0FFF, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x3FFF, 0x3FFF, 0x0000, 0x0000, //  214 <> 
+        8, /*N*/ 0x007F, 0x00FF, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  215 <> 
+       10, /*N*/ 0x0FFF, 0x0FFF, 0x0C00, 0x0C00, 0x0FFF, 0x0FFF, 0x0C00, 0x0C00, 0x0FFF, 0x0FFF, //  216 <> 
+       10, /*N*/ 0x0FFF, 0x0FFF, 0x0C00, 0x0C00, 0x0FFF, 0x0FFF, 0x0C00, 0x0C00, 0x3FFF, 0x3FFF, //  217 <> 
+        9, /*N*/ 0x0003, 0x0003, 0x0FFF, 0x0FFF, 0x0C60, 0x0C60, 0x0C60, 0x0FE0, 0x07C0, 0x0000, //  218 <> 
+       10, /*N*/ 0x0FFF, 0x0FFF, 0x0C60, 0x0C60, 0x0C60, 0x0FE0, 0x07C0, 0x0000, 0x0FFF, 0x0FFF, //  219 <> 
+        7, /*N*/ 0x0FFF, 0x0FFF, 0x0C60, 0x0C60, 0x0C60, 0x0FE0, 0x07C0, 0x0000, 0x0000, 0x0000, //  220 <> 
+        7, /*N*/ 0x0C03, 0x0C03, 0x0C63, 0x0C63, 0x0C63, 0x0FFF, 0x07FE, 0x0000, 0x0000, 0x0000, //  221 <> 
+        9, /*N*/ 0x0FFF, 0x0FFF, 0x0060, 0x07FE, 0x0FFF, 0x0C03, 0x0C03, 0x0FFF, 0x07FE, 0x0000, //  222 <> 
+        8, /*N*/ 0x0C7E, 0x0EFF, 0x07C3, 0x03C3, 0x01C3, 0x00C3, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  223 <> 
+
+        // Cyrillic Smalls / ,  
+        7, /*N*/ 0x0720, 0x0FB0, 0x0DB0, 0x0DB0, 0x0DB0, 0x0FF0, 0x0FE0, 0x0000, 0x0000, 0x0000, //  224 <> 
+        7, /*N*/ 0x07FC, 0x0FFE, 0x0C37, 0x0C33, 0x0C33, 0x0FF3, 0x07E0, 0x0000, 0x0000, 0x0000, //  225 <> 
+        7, /*N*/ 0x0FF0, 0x0FF0, 0x0DB0, 0x0DB0, 0x0DB0, 0x0FF0, 0x0760, 0x0000, 0x0000, 0x0000, //  226 <> 
+        6, /*N*/ 0x0FF0, 0x0FF0, 0x0030, 0x0030, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000, //  227 <> 
+        8, /*N*/ 0x1C00, 0x1FE0, 0x0FF0, 0x0C30, 0x0C30, 0x0FF0, 0x1FE0, 0x1C00, 0x0000, 0x0000, //  228 <> 
+        7, /*N*/ 0x07E0, 0x0FF0, 0x0DB0, 0x0DB0, 0x0DB0, 0x0DF0, 0x05E0, 0x0000, 0x0000, 0x0000, //  229 <> 
+        8, /*N*/ 0x0E70, 0x0FF0, 0x0180, 0x0FF0, 0x0FF0, 0x0180, 0x0FF0, 0x0E70, 0x0000, 0x0000, //  230 <> 
+        7, /*N*/ 0x0C30, 0x0DB0, 0x0DB0, 0x0DB0, 0x0DB0, 0x0FF0, 0x0660, 0x0000, 0x0000, 0x0000, //  231 <> 
+        7, /*N*/ 0x0FF0, 0x0FF0, 0x0300, 0x0180, 0x00C0, 0x0FF0, 0x0FF0, 0x0000, 0x0000, 0x0000, //  232 <> 
+        7, /*N*/ 0x0FF0, 0x0FF0, 0x0304, 0x0188, 0x00C4, 0x0FF0, 0x0FF0, 0x0000, 0x0000, 0x0000, //  233 <> 
+        7, /*N*/ 0x0FF0, 0x0FF0, 0x0180, 0x0180, 0x03C0, 0x0E70, 0x0C30, 0x0000, 0x0000, 0x0000, //  234 <> 
+        7, /*N*/ 0x0FC0, 0x0FE0, 0x0070, 0x0030, 0x0030, 0x0FF0, 0x0FF0, 0x0000, 0x0000, 0x0000, //  235 <> 
+        7, /*N*/ 0x0FF0, 0x0FF0, 0x00E0, 0x01C0, 0x00E0, 0x0FF0, 0x0FF0, 0x0000, 0x0000, 0x0000, //  236 <> 
+        7, /*N*/ 0x0FF0, 0x0FF0, 0x0180, 0x0180, 0x0180, 0x0FF0, 0x0FF0, 0x0000, 0x0000, 0x0000, //  237 <> 
+        7, /*N*/ 0x07E0, 0x0FF0, 0x0C30, 0x0C30, 0x0C30, 0x0FF0, 0x07E0, 0x0000, 0x0000, 0x0000, //  238 <> 
+        7, /*N*/ 0x0FF0, 0x0FF0, 0x0010, 0x0010, 0x0010, 0x0FF0, 0x0FF0, 0x0000, 0x0000, 0x0000, //  239 <> 
+        7, /*N*/ 0xFFF0, 0xFFF0, 0x0C30, 0x0C30, 0x0C30, 0x0FF0, 0x07E0, 0x0000, 0x0000, 0x0000, //  240 <> 
+        7, /*N*/ 0x07E0, 0x0FF0, 0x0C30, 0x0C30, 0x0C30, 0x0E70, 0x0660, 0x0000, 0x0000, 0x0000, //  241 <> 
+        6, /*N*/ 0x0030, 0x0030, 0x0FF0, 0x0FF0, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000, //  242 <> 
+        7, /*N*/ 0x47F0, 0xCFF0, 0xCC00, 0xCC00, 0xCC00, 0xFFF0, 0x7FF0, 0x0000, 0x0000, 0x0000, //  243 <> 
+        8, /*N*/ 0x07E0, 0x0FF0, 0x0C30, 0x1FF8, 0x1FF8, 0x0C30, 0x0FF0, 0x07E0, 0x0000, 0x0000, //  244 <> 
+        7, /*N*/ 0x0C30, 0x0E70, 0x03C0, 0x0180, 0x03C0, 0x0E70, 0x0C30, 0x0000, 0x0000, 0x0000, //  245 <> 
+        7, /*N*/ 0x0FF0, 0x0FF0, 0x0C00, 0x0C00, 0x0C00, 0x3FF0, 0x3FF0, 0x0000, 0x0000, 0x0000, //  246 <> 
+        7, /*N*/ 0x00F0, 0x01F0, 0x0180, 0x0180, 0x0180, 0x0FF0, 0x0FF0, 0x0000, 0x0000, 0x0000, //  247 <> 
+        8, /*N*/ 0x0FF0, 0x0FF0, 0x0C00, 0x0FF0, 0x0FF0, 0x0C00, 0x0FF0, 0x0FF0, 0x0000, 0x0000, //  248 <> 
+        8, /*N*/ 0x0FF0, 0x0FF0, 0x0C00, 0x0FF0, 0x0FF0, 0x0C00, 0x3FF0, 0x3FF0, 0x0000, 0x0000, //  249 <> 
+        7, /*N*/ 0x0010, 0x0FF0, 0x0FF0, 0x0D80, 0x0D80, 0x0F80, 0x0700, 0x0000, 0x0000, 0x0000, //  250 <> 
+        9, /*N*/ 0x0FF0, 0x0FF0, 0x0D80, 0x0D80, 0x0F80, 0x0700, 0x0000, 0x0FF0, 0x0FF0, 0x0000, //  251 <> 
+        6, /*N*/ 0x0FF0, 0x0FF0, 0x0D80, 0x0D80, 0x0F80, 0x0700, 0x0000, 0x0000, 0x0000, 0x0000, //  252 <> 
+        7, /*N*/ 0x0C30, 0x0C30, 0x0DB0, 0x0DB0, 0x0DB0, 0x0FF0, 0x07E0, 0x0000, 0x0000, 0x0000, //  253 <> 
+        8, /*N*/ 0x0FF0, 0x0FF0, 0x0180, 0x07E0, 0x0FF0, 0x0C30, 0x0FF0, 0x07E0, 0x0000, 0x0000, //  254 <> 
+        7, /*N*/ 0x08E0, 0x0DF0, 0x0790, 0x0390, 0x0190, 0x0FF0, 0x0FF0, 0x0000, 0x0000, 0x0000  //  255 <> 
+};
+
+
+#define FONT_EXTRA_16_LENGTH    7
+
+constexpr uint16_t font_extra_16_cps[FONT_EXTRA_16_LENGTH] = {0x00B0, 0x00B1, 0x00B5, 0x2190, 0x2191, 0x2192, 0x2193};
+
+constexpr uint16_t  font_extra_16[FONT_EXTRA_16_LENGTH * (1 + FONT_16_CHAR_WIDTH)] =
+{
+        5, /*N*/ 0x000E, 0x0011, 0x0011, 0x0011, 0x000E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // Symbol U+00B0 (degree)
+        8, /*N*/ 0x1860, 0x1860, 0x1860, 0x1BFC, 0x1BFC, 0x1860, 0x1860, 0x1860, 0x0000, 0x0000, // Symbol U+00B1 (plus-minus)
+        7, /*N*/ 0xFFF0, 0xFFF0, 0x0C00, 0x0C00, 0x0C00, 0x0FF0, 0x07F0, 0x0000, 0x0000, 0x0000, // Symbol U+00B5 (micro)
+       10, /*N*/ 0x0060, 0x00F0, 0x01F8, 0x036C, 0x0666, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, // Symbol U+2190 (left arrow)
+        8, /*N*/ 0x0018, 0x000C, 0x0006, 0x0FFF, 0x0FFF, 0x0006, 0x000C, 0x0018, 0x0000, 0x0000, // Symbol U+2191 (up arrow)
+       10, /*N*/ 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0666, 0x036C, 0x01F8, 0x00F0, 0x0060, // Symbol U+2192 (right arrow)
+        8, /*N*/ 0x0180, 0x0300, 0x0600, 0x0FFF, 0x0FFF, 0x0600, 0x0300, 0x0180, 0x0000, 0x0000, // Symbol U+2193 (down arrow)
+};
+
+
+
+
+
+//################################### DIGITS 32 ###################################//
+
+#define FONT_DIG_32_CHAR_WIDTH      19
+#define FONT_DIG_32_CHAR_HEIGHT     29
+#define FONT_DIG_32_CHAR_INTERVAL    3
+
+#define FONT_DIG_32_LENGTH          10
+#define FONT_DIG_32_START_CHAR      48
+#define FONT_DIG_32_ARRAY_LENGTH     (FONT_DIG_32_LENGTH * (1 + FONT_DIG_32_CHAR_WIDTH))
+
+
+constexpr unsigned long  font_dig_32[FONT_DIG_32_ARRAY_LENGTH] =
+{
+
+        // Digits /  
+            19, /*N*/ 0x000FFC00, 0x007FFF80, 0x01FFFFE0, 0x03FFFFF8, 0x07E000FC, 0x0E00000E, 0x0C000006, 0x18000003, 0x10000001, 0x10000001, 0x10000001, 0x18000003, 0x0C000002, 0x0E00000E, 0x07E0007C, 0x03FFFFF8, 0x01FFFFF0, 0x007FFFC0, 0x0007FE00, //  48  <0> 
+            11, /*N*/ 0x10000008, 0x1000000C, 0x10000004, 0x1800000E, 0x1FFFFFFE, 0x1FFFFFFF, 0x1FFFFFFF, 0x18000000, 0x10000000, 0x10000000, 0x10000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, //  49  <1> 
+            19, /*N*/ 0x100000C0, 0x18000070, 0x1C000018, 0x1E00001C, 0x1E00000E, 0x1D000006, 0x1C800007, 0x1C400007, 0x1C200007, 0x1C300007, 0x1C180007, 0x1C0C000F, 0x1C06000E, 0x1C03801E, 0x1C00E07C, 0x1C007FFC, 0x1C001FF8, 0x1E0007E0, 0x06000000, //  50  <2> 
+            17, /*N*/ 0x0E000060, 0x0E000030, 0x1E00001C, 0x1E00000E, 0x1C00000E, 0x1C004007, 0x18004007, 0x18006007, 0x18006007, 0x0800F00F, 0x0800F80F, 0x0C01FC1E, 0x0603E7FE, 0x0707E3FC, 0x03FFC0F0, 0x00FF8000, 0x007E0000, 0x00000000, 0x00000000, //  51  <3> 
+            19, /*N*/ 0x001C0000, 0x001F0000, 0x001F8000, 0x001CC000, 0x001C6000, 0x001C3000, 0x001C1C00, 0x001C0E00, 0x001C0300, 0x001C0180, 0x001C00E0, 0x001C0070, 0x001C0038, 0x001C000C, 0x1FFFFFFE, 0x1FFFFFFF, 0x1FFFFFFF, 0x001C0000, 0x001C0000, //  52  <4> 
+            17, /*N*/ 0x0E000000, 0x0E000400, 0x1E000700, 0x1C0007C0, 0x1C0007F0, 0x18000FBC, 0x18000F8F, 0x18000F07, 0x18001F07, 0x08001F07, 0x0C003E07, 0x04007E07, 0x0600FC07, 0x0383F807, 0x01FFF007, 0x007FE007, 0x001F8001, 0x00000000, 0x00000000, //  53  <5> 
+            19, /*N*/ 0x001FC000, 0x00FFF800, 0x01FFFE00, 0x03FFFF80, 0x07803FC0, 0x0E0033E0, 0x0C0030F0, 0x18001070, 0x10001838, 0x1000181C, 0x1000180C, 0x10003806, 0x18003806, 0x0C00F802, 0x0E03F003, 0x07FFF003, 0x03FFE001, 0x00FFC001, 0x003F0001, //  54  <6> 
+            19, /*N*/ 0x00000060, 0x00000018, 0x0000000E, 0x0000000F, 0x00000007, 0x00000007, 0x00000007, 0x18000007, 0x1F000007, 0x0FC00007, 0x01F80007, 0x003F0007, 0x0007E007, 0x0000FC07, 0x00001F87, 0x000007E7, 0x000000FF, 0x0000001F, 0x00000003, //  55  <7> 
+            17, /*N*/ 0x00F001F0, 0x03FC07F8, 0x07FE0FFC, 0x0E071F86, 0x0C019E02, 0x1800BC03, 0x10007C01, 0x1000F801, 0x1000F001, 0x1001F001, 0x1003D001, 0x1807D803, 0x080F8C02, 0x0C1F070E, 0x07FE07FC, 0x03FC03F8, 0x01F800F0, 0x00000000, 0x00000000, //  56  <8> 
+            19, /*N*/ 0x10001F80, 0x10007FF0, 0x1000FFF8, 0x1001FFFC, 0x1801F80E, 0x0803E006, 0x0C038003, 0x0C038001, 0x06030001, 0x07030001, 0x03830001, 0x01C10003, 0x01E10006, 0x00F9800E, 0x007E807C, 0x003FFFF8, 0x000FFFF0, 0x0003FFE0, 0x0000FF00  //  57  <9> 
+};
+
+
+
+
+
+//################################### FONT TABLES ###################################//
+
+constexpr FontTables<unsigned char> font5_tables = {font_en_5, font_ru_5, font_extra_5, font_extra_5_cps, FONT_EN_5_LENGTH, FONT_RU_5_LENGTH, 
+                                                    FONT_EXTRA_5_LENGTH, FONT_5_CHAR_WIDTH, FONT_5_CHAR_HEIGHT, FONT_5_CHAR_INTERVAL, FONT_EN_5_START_CHAR};
+
+constexpr FontTables<unsigned char> font8_tables = {font_en_8, font_ru_8, font_extra_8, font_extra_8_cps, FONT_EN_8_LENGTH, FONT_RU_8_LENGTH, 
+                                                    FONT_EXTRA_8_LENGTH, FONT_8_CHAR_WIDTH, FONT_8_CHAR_HEIGHT, FONT_8_CHAR_INTERVAL, FONT_EN_8_START_CHAR};
+
+constexpr FontTables<unsigned short> font16_tables = {font_en_16, font_ru_16, font_extra_16, font_extra_16_cps, FONT_EN_16_LENGTH, FONT_RU_16_LENGTH, 
+                                                      FONT_EXTRA_16_LENGTH, FONT_16_CHAR_WIDTH, FONT_16_CHAR_HEIGHT, FONT_16_CHAR_INTERVAL, FONT_EN_16_START_CHAR};
+
+constexpr FontTables<unsigned long> font_dig32_tables = {font_dig_32, (const unsigned long*)0, (const unsigned long*)0, (const uint16_t*)0, FONT_DIG_32_LENGTH, 0, 
+                                                         0, FONT_DIG_32_CHAR_WIDTH, FONT_DIG_32_CHAR_HEIGHT, FONT_DIG_32_CHAR_INTERVAL, FONT_DIG_32_START_CHAR};
@@ -22,667 +22,269 @@
     uint8_t     |    <= 8
     uint16_t    |    <= 16
     uint32_t    |    <= 32
+
+                        ##### Packed fonts #####
+  ==============================================================================
+
+  Font array may be packed at compile time to save flash: symbols are stored with their own width, without empty rows
+  above and below them and without repeated columns (see "pack_font" in ssd1306_fonts.hpp). Only the packed array is linked:
+
+    constexpr unsigned my_font_packed_sz = packed_font_size<LENGTH, CHAR_WIDTH, CHAR_HEIGHT>(my_font);
+    constexpr PackedFont<my_font_packed_sz> my_font_packed = pack_font<my_font_packed_sz, LENGTH, CHAR_WIDTH, CHAR_HEIGHT>(my_font);
+    Font font = {SSD1306_FONT_FORMAT::PACKED, CHAR_WIDTH, CHAR_HEIGHT, CHAR_INTERVAL, (void*)my_font_packed.data, ...};
+
+  Columns of packed symbols are decoded one by one while drawing. font16 and font_dig32 are packed 
+  (3498 -> 1730 and 800 -> 692 bytes), font5 and font8 are raw: they gain little and are measured faster.
+
+                        ##### Strings encoding and extra symbols #####
+  ==============================================================================
+
+  Strings may be written in UTF-8 or in Windows 1251. Every symbol of the string is converted to the glyph code of the font 
+  by "Font::read_code" in one pass: latin symbols have codes 32 .. 126, cyrillic "" .. "" - 192 .. 255 (as in Windows 1251).
+  Other symbols (degree, micro, arrows...) are stored sparsely - only the symbols which are needed, without padding
+  the whole 64 symbols block. Their code points are listed in the sorted "*_extra_cps" table and they get glyph codes 0x80 + index.
+  Symbols which are not found are shown as "?".
+
+                        ##### Static labels #####
+  ==============================================================================
+
+  Font arrays are kept in ssd1306_font_tables.hpp, so constant strings may be rasterized at compile time 
+  (see "SSD1306_STATIC_LABEL" in ssd1306_fonts.hpp) and drawn by one blit, without measuring and decoding glyphs.
 */
 
 
 #include "ssd1306_fonts.hpp"
+#include "ssd1306_font_tables.hpp"
 
 
 
 
 //################################### FONT 5 ###################################//
 
+constexpr FontWidths<FONT_EN_5_LENGTH> font_en_5_widths = font_widths<FONT_EN_5_LENGTH, FONT_5_CHAR_WIDTH>(font_en_5);
+constexpr FontWidths<FONT_RU_5_LENGTH> font_ru_5_widths = font_widths<FONT_RU_5_LENGTH, FONT_5_CHAR_WIDTH>(font_ru_5);
 
-#define FONT_5_CHAR_WIDTH       4
-#define FONT_5_CHAR_HEIGHT      5
-#define FONT_5_CHAR_INTERVAL    1
 
-#define FONT_EN_5_LENGTH        95
-#define FONT_EN_5_START_CHAR    32
-#define FONT_EN_5_ARRAY_LENGTH  (FONT_EN_5_LENGTH * (1 + FONT_5_CHAR_WIDTH))
+Font font5 = {Font(FONT_5_CHAR_WIDTH, FONT_5_CHAR_HEIGHT, FONT_5_CHAR_INTERVAL, (void*)font_en_5, (void*)font_ru_5, font_en_5_widths.w, font_ru_5_widths.w), 
+              font_extra_5_cps, (void*)font_extra_5, FONT_EXTRA_5_LENGTH};
 
-#define FONT_RU_5_LENGTH        64
-#define FONT_RU_5_START_CHAR    192
-#define FONT_RU_5_ARRAY_LENGTH  (FONT_RU_5_LENGTH * (1 + FONT_5_CHAR_WIDTH))
 
+//################################### FONT 8 ###################################//
 
+constexpr FontWidths<FONT_EN_8_LENGTH> font_en_8_widths = font_widths<FONT_EN_8_LENGTH, FONT_8_CHAR_WIDTH>(font_en_8);
+constexpr FontWidths<FONT_RU_8_LENGTH> font_ru_8_widths = font_widths<FONT_RU_8_LENGTH, FONT_8_CHAR_WIDTH>(font_ru_8);
 
-const unsigned char  font_en_5[FONT_EN_5_ARRAY_LENGTH] =
-{
-  3, /*N*/ 0x00, 0x00, 0x00, 0x00, //  32  < > 
-  1, /*N*/ 0x17, 0x00, 0x00, 0x00, //  33  <!> 
-  3, /*N*/ 0x03, 0x00, 0x03, 0x00, //  34  <"> 
-  4, /*N*/ 0x0A, 0x1F, 0x0A, 0x1F, //  35  <#> 
-  4, /*N*/ 0x07, 0x11, 0x11, 0x1C, //  36  <$> 
-  3, /*N*/ 0x09, 0x04, 0x12, 0x00, //  37  <%> 
-  4, /*N*/ 0x1F, 0x1F, 0x1F, 0x1F, //  38  <&> 
-  3, /*N*/ 0x00, 0x00, 0x03, 0x00, //  39  <'> 
-  2, /*N*/ 0x0E, 0x11, 0x00, 0x00, //  40  <(> 
-  2, /*N*/ 0x11, 0x0E, 0x00, 0x00, //  41  <)> 
-  3, /*N*/ 0x0A, 0x04, 0x0A, 0x00, //  42  <*> 
-  3, /*N*/ 0x04, 0x0E, 0x04, 0x00, //  43  <+> 
-  2, /*N*/ 0x10, 0x08, 0x00, 0x00, //  44  <,> 
-  3, /*N*/ 0x04, 0x04, 0x04, 0x00, //  45  <-> 
-  1, /*N*/ 0x10, 0x00, 0x00, 0x00, //  46  <.> 
-  4, /*N*/ 0x10, 0x08, 0x04, 0x02, //  47  </> 
-
-    // Digits /  
-  4, /*N*/ 0x0E, 0x11, 0x11, 0x0E, //  48  <0> 
-  3, /*N*/ 0x12, 0x1F, 0x10, 0x00, //  49  <1> 
-  4, /*N*/ 0x19, 0x15, 0x15, 0x12, //  50  <2> 
-  4, /*N*/ 0x15, 0x15, 0x15, 0x0A, //  51  <3> 
-  4, /*N*/ 0x07, 0x04, 0x04, 0x1F, //  52  <4> 
-  4, /*N*/ 0x17, 0x15, 0x15, 0x1D, //  53  <5> 
-  4, /*N*/ 0x1E, 0x15, 0x15, 0x1D, //  54  <6> 
-  4, /*N*/ 0x01, 0x19, 0x05, 0x03, //  55  <7> 
-  4, /*N*/ 0x0A, 0x15, 0x15, 0x0A, //  56  <8> 
-  4, /*N*/ 0x17, 0x15, 0x15, 0x0E, //  57  <9> 
-
-  1, /*N*/ 0x12, 0x00, 0x00, 0x00, //  58  <:> 
-  2, /*N*/ 0x10, 0x0A, 0x00, 0x00, //  59  <;> 
-  3, /*N*/ 0x04, 0x0A, 0x11, 0x00, //  60  <<> 
-  3, /*N*/ 0x0A, 0x0A, 0x0A, 0x00, //  61  <=> 
-  3, /*N*/ 0x11, 0x0A, 0x04, 0x00, //  62  <>> 
-  3, /*N*/ 0x01, 0x15, 0x03, 0x00, //  63  <?> 
-  4, /*N*/ 0x1E, 0x11, 0x0D, 0x0F, //  64  <@> 
-
-    // Roman Capitals / ,  
-  4, /*N*/ 0x1E, 0x09, 0x09, 0x1E, //  65  <A> 
-  4, /*N*/ 0x1F, 0x15, 0x15, 0x0A, //  66  <B> 
-  3, /*N*/ 0x0E, 0x11, 0x11, 0x00, //  67  <C> 
-  4, /*N*/ 0x1F, 0x11, 0x11, 0x0E, //  68  <D> 
-  4, /*N*/ 0x1F, 0x15, 0x15, 0x11, //  69  <E> 
-  4, /*N*/ 0x1F, 0x05, 0x05, 0x01, //  70  <F> 
-  4, /*N*/ 0x0E, 0x11, 0x19, 0x1A, //  71  <G> 
-  4, /*N*/ 0x1F, 0x04, 0x04, 0x1F, //  72  <H> 
-  3, /*N*/ 0x11, 0x1F, 0x11, 0x00, //  73  <I> 
-  4, /*N*/ 0x08, 0x11, 0x1F, 0x01, //  74  <J> 
-  4, /*N*/ 0x1F, 0x04, 0x06, 0x19, //  75  <K> 
-  3, /*N*/ 0x1F, 0x10, 0x10, 0x00, //  76  <L> 
-  4, /*N*/ 0x1F, 0x02, 0x02, 0x1F, //  77  <M> 
-  4, /*N*/ 0x1F, 0x02, 0x04, 0x1F, //  78  <N> 
-  4, /*N*/ 0x0E, 0x11, 0x11, 0x0E, //  79  <O> 
-  4, /*N*/ 0x1F, 0x09, 0x09, 0x06, //  80  <P> 
-  4, /*N*/ 0x0E, 0x11, 0x09, 0x16, //  81  <Q> 
-  4, /*N*/ 0x1F, 0x05, 0x0D, 0x12, //  82  <R> 
-  4, /*N*/ 0x12, 0x15, 0x15, 0x09, //  83  <S> 
-  3, /*N*/ 0x01, 0x1F, 0x01, 0x00, //  84  <T> 
-  4, /*N*/ 0x0F, 0x10, 0x10, 0x0F, //  85  <U> 
-  4, /*N*/ 0x0F, 0x10, 0x10, 0x0F, //  86  <V> 
-  4, /*N*/ 0x0F, 0x18, 0x18, 0x0F, //  87  <W> 
-  4, /*N*/ 0x1B, 0x04, 0x04, 0x1B, //  88  <X> 
-  4, /*N*/ 0x17, 0x14, 0x14, 0x0F, //  89  <Y> 
-  4, /*N*/ 0x19, 0x15, 0x15, 0x13, //  90  <Z> 
-
-  2, /*N*/ 0x1F, 0x11, 0x00, 0x00, //  91  <[> 
-  4, /*N*/ 0x02, 0x04, 0x08, 0x10, //  92  <\> 
-  4, /*N*/ 0x00, 0x00, 0x11, 0x1F, //  93  <]> 
-  3, /*N*/ 0x02, 0x01, 0x02, 0x00, //  94  <^> 
-  4, /*N*/ 0x10, 0x10, 0x10, 0x10, //  95  <_> 
-  4, /*N*/ 0x00, 0x00, 0x01, 0x02, //  96  <`> 
-
-    // Roman Smalls / ,  
-  4, /*N*/ 0x1C, 0x0A, 0x0A, 0x1C, //  97  <a> 
-  4, /*N*/ 0x1F, 0x12, 0x12, 0x0C, //  98  <b> 
-  3, /*N*/ 0x0C, 0x12, 0x12, 0x00, //  99  <c> 
-  4, /*N*/ 0x00, 0x0C, 0x12, 0x1F, //  100 <d> 
-  3, /*N*/ 0x0C, 0x1A, 0x16, 0x00, //  101 <e> 
-  3, /*N*/ 0x04, 0x1F, 0x05, 0x00, //  102 <f> 
-  4, /*N*/ 0x10, 0x16, 0x1A, 0x0C, //  103 <g> 
-  4, /*N*/ 0x1F, 0x02, 0x02, 0x1C, //  104 <h> 
-  1, /*N*/ 0x1D, 0x00, 0x00, 0x00, //  105 <i> 
-  3, /*N*/ 0x08, 0x10, 0x1D, 0x00, //  106 <j> 
-  4, /*N*/ 0x1F, 0x04, 0x0A, 0x10, //  107 <k> 
-  1, /*N*/ 0x1E, 0x00, 0x00, 0x00, //  108 <l> 
-  4, /*N*/ 0x1E, 0x04, 0x04, 0x1E, //  109 <m> 
-  4, /*N*/ 0x1E, 0x02, 0x02, 0x1C, //  110 <n> 
-  4, /*N*/ 0x0C, 0x12, 0x12, 0x0C, //  111 <o> 
-  4, /*N*/ 0x1E, 0x0A, 0x0A, 0x04, //  112 <p> 
-  4, /*N*/ 0x00, 0x04, 0x0A, 0x1E, //  113 <q> 
-  3, /*N*/ 0x1C, 0x02, 0x02, 0x00, //  114 <r> 
-  3, /*N*/ 0x14, 0x1E, 0x0A, 0x00, //  115 <s> 
-  3, /*N*/ 0x02, 0x1F, 0x12, 0x00, //  116 <t> 
-  4, /*N*/ 0x0E, 0x10, 0x10, 0x0E, //  117 <u> 
-  3, /*N*/ 0x0E, 0x10, 0x0E, 0x00, //  118 <v> 
-  4, /*N*/ 0x0E, 0x18, 0x18, 0x0E, //  119 <w> 
-  3, /*N*/ 0x12, 0x0C, 0x12, 0x00, //  120 <x> 
-  3, /*N*/ 0x16, 0x18, 0x0E, 0x00, //  121 <y> 
-  3, /*N*/ 0x12, 0x1A, 0x16, 0x00, //  122 <z> 
-
-  3, /*N*/ 0x04, 0x1B, 0x11, 0x00, //  123 <{> 
-  1, /*N*/ 0x1F, 0x00, 0x00, 0x00, //  124 <|> 
-  3, /*N*/ 0x11, 0x1B, 0x04, 0x00, //  125 <}> 
-  4, /*N*/ 0x04, 0x02, 0x04, 0x02  //  126 <~> 
-};
 
-const unsigned char  font_ru_5[FONT_RU_5_ARRAY_LENGTH] =
-{
+Font font8 = {Font(FONT_8_CHAR_WIDTH, FONT_8_CHAR_HEIGHT, FONT_8_CHAR_INTERVAL, (void*)font_en_8, (void*)font_ru_8, font_en_8_widths.w, font_ru_8_widths.w), 
+              font_extra_8_cps, (void*)font_extra_8, FONT_EXTRA_8_LENGTH};
 
-  // Cyrillic Capitals / ,  
-4, /*N*/ 0x1E, 0x09, 0x09, 0x1E, //  192 <> 
-4, /*N*/ 0x1F, 0x15, 0x15, 0x1D, //  193 <> 
-4, /*N*/ 0x1F, 0x15, 0x15, 0x0A, //  194 <> 
-4, /*N*/ 0x1F, 0x01, 0x01, 0x03, //  195 <> 
-4, /*N*/ 0x18, 0x0F, 0x09, 0x1F, //  196 <> 
-4, /*N*/ 0x1F, 0x15, 0x15, 0x11, //  197 <> 
-4, /*N*/ 0x1B, 0x0E, 0x1F, 0x0E, //  198 <> 
-4, /*N*/ 0x11, 0x15, 0x15, 0x1F, //  199 <> 
-4, /*N*/ 0x1F, 0x08, 0x04, 0x1F, //  200 <> 
-4, /*N*/ 0x1E, 0x09, 0x05, 0x1E, //  201 <> 
-4, /*N*/ 0x1F, 0x04, 0x06, 0x19, //  202 <> 
-4, /*N*/ 0x10, 0x1F, 0x01, 0x1F, //  203 <> 
-4, /*N*/ 0x1F, 0x02, 0x02, 0x1F, //  204 <> 
-4, /*N*/ 0x1F, 0x04, 0x04, 0x1F, //  205 <> 
-4, /*N*/ 0x0E, 0x11, 0x11, 0x0E, //  206 <> 
-4, /*N*/ 0x1F, 0x01, 0x01, 0x1F, //  207 <> 
-4, /*N*/ 0x1F, 0x05, 0x05, 0x07, //  208 <> 
-4, /*N*/ 0x0E, 0x11, 0x11, 0x11, //  209 <> 
-3, /*N*/ 0x01, 0x1F, 0x01, 0x00, //  210 <> 
-4, /*N*/ 0x13, 0x14, 0x14, 0x0F, //  211 <> 
-4, /*N*/ 0x0F, 0x09, 0x1F, 0x09, //  212 <> 
-4, /*N*/ 0x1B, 0x04, 0x04, 0x1B, //  213 <> 
-4, /*N*/ 0x0F, 0x08, 0x08, 0x1F, //  214 <> 
-4, /*N*/ 0x07, 0x04, 0x04, 0x1F, //  215 <> 
-4, /*N*/ 0x1F, 0x08, 0x08, 0x1F, //  216 <> 
-4, /*N*/ 0x1F, 0x08, 0x18, 0x1F, //  217 <> 
-4, /*N*/ 0x01, 0x1F, 0x14, 0x1C, //  218 <> 
-4, /*N*/ 0x1F, 0x14, 0x08, 0x1F, //  219 <> 
-3, /*N*/ 0x1F, 0x14, 0x1C, 0x00, //  220 <> 
-3, /*N*/ 0x11, 0x15, 0x0E, 0x00, //  221 <> 
-4, /*N*/ 0x1F, 0x04, 0x1F, 0x11, //  222 <> 
-4, /*N*/ 0x12, 0x0D, 0x05, 0x1F, //  223 <> 
-
-  // Cyrillic Smalls / ,  
-4, /*N*/ 0x1C, 0x0A, 0x0A, 0x1C, //  224 <> 
-4, /*N*/ 0x1E, 0x15, 0x15, 0x09, //  225 <> 
-3, /*N*/ 0x1E, 0x15, 0x0A, 0x00, //  226 <> 
-3, /*N*/ 0x1E, 0x02, 0x02, 0x00, //  227 <> 
-4, /*N*/ 0x18, 0x0E, 0x0A, 0x1E, //  228 <> 
-3, /*N*/ 0x0C, 0x1A, 0x16, 0x00, //  229 <> 
-4, /*N*/ 0x1A, 0x0C, 0x1E, 0x0C, //  230 <> 
-3, /*N*/ 0x12, 0x16, 0x1A, 0x00, //  231 <> 
-4, /*N*/ 0x1E, 0x08, 0x04, 0x1E, //  232 <> 
-4, /*N*/ 0x1E, 0x08, 0x05, 0x1E, //  233 <> 
-4, /*N*/ 0x1F, 0x04, 0x0A, 0x10, //  234 <> 
-4, /*N*/ 0x10, 0x0C, 0x02, 0x1E, //  235 <> 
-4, /*N*/ 0x1E, 0x04, 0x04, 0x1E, //  236 <> 
-4, /*N*/ 0x1E, 0x04, 0x04, 0x1E, //  237 <> 
-4, /*N*/ 0x0C, 0x12, 0x12, 0x0C, //  238 <> 
-4, /*N*/ 0x1E, 0x02, 0x02, 0x1E, //  239 <> 
-4, /*N*/ 0x1E, 0x0A, 0x0A, 0x04, //  240 <> 
-3, /*N*/ 0x0C, 0x12, 0x12, 0x00, //  241 <> 
-3, /*N*/ 0x02, 0x1E, 0x02, 0x00, //  242 <> 
-4, /*N*/ 0x16, 0x18, 0x08, 0x06, //  243 <> 
-4, /*N*/ 0x0E, 0x0A, 0x1F, 0x0A, //  244 <> 
-3, /*N*/ 0x12, 0x0C, 0x12, 0x00, //  245 <> 
-4, /*N*/ 0x1E, 0x10, 0x1E, 0x10, //  246 <> 
-4, /*N*/ 0x06, 0x08, 0x08, 0x1E, //  247 <> 
-4, /*N*/ 0x1E, 0x08, 0x08, 0x1E, //  248 <> 
-4, /*N*/ 0x1E, 0x08, 0x18, 0x1E, //  249 <> 
-4, /*N*/ 0x02, 0x1E, 0x14, 0x1C, //  250 <> 
-4, /*N*/ 0x1E, 0x14, 0x08, 0x1E, //  251 <> 
-3, /*N*/ 0x1E, 0x14, 0x1C, 0x00, //  252 <> 
-3, /*N*/ 0x12, 0x16, 0x0E, 0x00, //  253 <> 
-4, /*N*/ 0x1E, 0x0C, 0x12, 0x0C, //  254 <> 
-4, /*N*/ 0x14, 0x0A, 0x0A, 0x1E  //  255 <> 
-};
 
 
-Font font5 = {FONT_5_CHAR_WIDTH, FONT_5_CHAR_HEIGHT, FONT_5_CHAR_INTERVAL, (void*)font_en_5, (void*)font_ru_5};
 
 
-//################################### FONT 8 ###################################//
+//################################### FONT 16 ###################################//
 
-#define FONT_8_CHAR_WIDTH       5
-#define FONT_8_CHAR_HEIGHT      8
-#define FONT_8_CHAR_INTERVAL    1
+constexpr unsigned font_en_16_packed_sz = packed_font_size<FONT_EN_16_LENGTH, FONT_16_CHAR_WIDTH, FONT_16_CHAR_HEIGHT>(font_en_16);
+constexpr unsigned font_ru_16_packed_sz = packed_font_size<FONT_RU_16_LENGTH, FONT_16_CHAR_WIDTH, FONT_16_CHAR_HEIGHT>(font_ru_16);
+constexpr PackedFont<font_en_16_packed_sz> font_en_16_packed = pack_font<font_en_16_packed_sz, FONT_EN_16_LENGTH, FONT_16_CHAR_WIDTH, FONT_16_CHAR_HEIGHT>(font_en_16);
+constexpr PackedFont<font_ru_16_packed_sz> font_ru_16_packed = pack_font<font_ru_16_packed_sz, FONT_RU_16_LENGTH, FONT_16_CHAR_WIDTH, FONT_16_CHAR_HEIGHT>(font_ru_16);
 
-#define FONT_EN_8_LENGTH        95
-#define FONT_EN_8_START_CHAR    32
-#define FONT_EN_8_ARRAY_LENGTH  (FONT_EN_8_LENGTH * (1 + FONT_8_CHAR_WIDTH))
+Font font16 = {Font(SSD1306_FONT_FORMAT::PACKED, FONT_16_CHAR_WIDTH, FONT_16_CHAR_HEIGHT, FONT_16_CHAR_INTERVAL, (void*)font_en_16_packed.data, (void*)font_ru_16_packed.data), 
+               font_extra_16_cps, (void*)font_extra_16, FONT_EXTRA_16_LENGTH};
 
-#define FONT_RU_8_LENGTH        64
-#define FONT_RU_8_START_CHAR    192
-#define FONT_RU_8_ARRAY_LENGTH  (FONT_RU_8_LENGTH * (1 + FONT_8_CHAR_WIDTH))
 
 
-const unsigned char  font_en_8[FONT_EN_8_ARRAY_LENGTH] =
-{
-3, /*N*/ 0x00, 0x00, 0x00, 0x00, 0x00, //  32  < > 
-      1, /*N*/ 0x5F, 0x00, 0x00, 0x00, 0x00, //  33  <!> 
-      3, /*N*/ 0x03, 0x00, 0x03, 0x00, 0x00, //  34  <"> 
-      5, /*N*/ 0x14, 0x7F, 0x14, 0x7F, 0x14, //  35  <#> 
-      5, /*N*/ 0x24, 0x2A, 0x7F, 0x2A, 0x12, //  36  <$> 
-      5, /*N*/ 0x46, 0x26, 0x10, 0xC8, 0xC4, //  37  <%> 
-      5, /*N*/ 0x36, 0x49, 0x55, 0x22, 0x50, //  38  <&> 
-      1, /*N*/ 0x03, 0x00, 0x00, 0x00, 0x00, //  39  <'> 
-      3, /*N*/ 0x1C, 0x22, 0x41, 0x00, 0x00, //  40  <(> 
-      3, /*N*/ 0x41, 0x22, 0x1C, 0x00, 0x00, //  41  <)> 
-      5, /*N*/ 0x14, 0x08, 0x3E, 0x08, 0x14, //  42  <*> 
-      5, /*N*/ 0x08, 0x08, 0x3E, 0x08, 0x08, //  43  <+> 
-      2, /*N*/ 0xA0, 0x60, 0x00, 0x00, 0x00, //  44  <,> 
-      5, /*N*/ 0x08, 0x08, 0x08, 0x08, 0x08, //  45  <-> 
-      2, /*N*/ 0x60, 0x60, 0x00, 0x00, 0x00, //  46  <.> 
-      4, /*N*/ 0xC0, 0x30, 0x0C, 0x03, 0x00, //  47  </> 
-
-        // Digits /  
-      5, /*N*/ 0x3E, 0x51, 0x49, 0x45, 0x3E, //  48  <0> 
-      3, /*N*/ 0x42, 0x7F, 0x40, 0x00, 0x00, //  49  <1> 
-      5, /*N*/ 0x42, 0x61, 0x51, 0x49, 0x46, //  50  <2> 
-      5, /*N*/ 0x21, 0x41, 0x45, 0x4B, 0x31, //  51  <3> 
-      5, /*N*/ 0x18, 0x14, 0x12, 0x7F, 0x10, //  52  <4> 
-      5, /*N*/ 0x27, 0x45, 0x45, 0x45, 0x39, //  53  <5> 
-      5, /*N*/ 0x3C, 0x4A, 0x49, 0x49, 0x30, //  54  <6> 
-      5, /*N*/ 0x01, 0x71, 0x09, 0x05, 0x03, //  55  <7> 
-      5, /*N*/ 0x36, 0x49, 0x49, 0x49, 0x36, //  56  <8> 
-      5, /*N*/ 0x06, 0x49, 0x49, 0x29, 0x1E, //  57  <9> 
-
-      2, /*N*/ 0x66, 0x66, 0x00, 0x00, 0x00, //  58  <:> 
-      2, /*N*/ 0xA6, 0x66, 0x00, 0x00, 0x00, //  59  <;> 
-      4, /*N*/ 0x08, 0x14, 0x22, 0x41, 0x00, //  60  <<> 
-      5, /*N*/ 0x14, 0x14, 0x14, 0x14, 0x14, //  61  <=> 
-      4, /*N*/ 0x41, 0x22, 0x14, 0x08, 0x00, //  62  <>> 
-      5, /*N*/ 0x02, 0x01, 0x51, 0x09, 0x06, //  63  <?> 
-      5, /*N*/ 0x3E, 0x41, 0x5D, 0x55, 0x1E, //  64  <@> 
-
-        // Roman Capitals / ,  
-      5, /*N*/ 0x7E, 0x11, 0x11, 0x11, 0x7E, //  65  <A> 
-      5, /*N*/ 0x7F, 0x49, 0x49, 0x49, 0x36, //  66  <B> 
-      5, /*N*/ 0x3E, 0x41, 0x41, 0x41, 0x22, //  67  <C> 
-      5, /*N*/ 0x7F, 0x41, 0x41, 0x41, 0x3E, //  68  <D> 
-      5, /*N*/ 0x7F, 0x49, 0x49, 0x49, 0x41, //  69  <E> 
-      5, /*N*/ 0x7F, 0x09, 0x09, 0x09, 0x01, //  70  <F> 
-      5, /*N*/ 0x3E, 0x41, 0x49, 0x49, 0x7A, //  71  <G> 
-      5, /*N*/ 0x7F, 0x08, 0x08, 0x08, 0x7F, //  72  <H> 
-      3, /*N*/ 0x41, 0x7F, 0x41, 0x00, 0x00, //  73  <I> 
-      5, /*N*/ 0x20, 0x40, 0x41, 0x3F, 0x01, //  74  <J> 
-      5, /*N*/ 0x7F, 0x08, 0x14, 0x22, 0x41, //  75  <K> 
-      5, /*N*/ 0x7F, 0x40, 0x40, 0x40, 0x40, //  76  <L> 
-      5, /*N*/ 0x7F, 0x02, 0x0C, 0x02, 0x7F, //  77  <M> 
-      5, /*N*/ 0x7F, 0x04, 0x08, 0x10, 0x7F, //  78  <N> 
-      5, /*N*/ 0x3E, 0x41, 0x41, 0x41, 0x3E, //  79  <O> 
-      5, /*N*/ 0x7F, 0x11, 0x11, 0x11, 0x0E, //  80  <P> 
-      5, /*N*/ 0x3E, 0x41, 0x51, 0x21, 0x5E, //  81  <Q> 
-      5, /*N*/ 0x7F, 0x09, 0x19, 0x29, 0x46, //  82  <R> 
-      5, /*N*/ 0x26, 0x49, 0x49, 0x49, 0x32, //  83  <S> 
-      5, /*N*/ 0x01, 0x01, 0x7F, 0x01, 0x01, //  84  <T> 
-      5, /*N*/ 0x3F, 0x40, 0x40, 0x40, 0x3F, //  85  <U> 
-      5, /*N*/ 0x1F, 0x20, 0x40, 0x20, 0x1F, //  86  <V> 
-      5, /*N*/ 0x3F, 0x40, 0x38, 0x40, 0x3F, //  87  <W> 
-      5, /*N*/ 0x63, 0x14, 0x08, 0x14, 0x63, //  88  <X> 
-      5, /*N*/ 0x07, 0x08, 0x70, 0x08, 0x07, //  89  <Y> 
-      5, /*N*/ 0x61, 0x51, 0x49, 0x45, 0x43, //  90  <Z> 
-
-      2, /*N*/ 0x7F, 0x41, 0x00, 0x00, 0x00, //  91  <[> 
-      4, /*N*/ 0x03, 0x0C, 0x30, 0xC0, 0x00, //  92  <\> 
-      2, /*N*/ 0x41, 0x7F, 0x00, 0x00, 0x00, //  93  <]> 
-      5, /*N*/ 0x04, 0x02, 0x01, 0x02, 0x04, //  94  <^> 
-      5, /*N*/ 0x80, 0x80, 0x80, 0x80, 0x80, //  95  <_> 
-      2, /*N*/ 0x01, 0x02, 0x00, 0x00, 0x00, //  96  <`> 
-
-        // Roman Smalls / ,  
-      5, /*N*/ 0x20, 0x54, 0x54, 0x54, 0x78, //  97  <a> 
-      5, /*N*/ 0x7F, 0x48, 0x44, 0x44, 0x38, //  98  <b> 
-      4, /*N*/ 0x38, 0x44, 0x44, 0x44, 0x00, //  99  <c> 
-      5, /*N*/ 0x38, 0x44, 0x44, 0x48, 0x7F, //  100 <d> 
-      5, /*N*/ 0x38, 0x54, 0x54, 0x54, 0x18, //  101 <e> 
-      5, /*N*/ 0x08, 0x7E, 0x09, 0x01, 0x02, //  102 <f> 
-      5, /*N*/ 0x4C, 0x92, 0x92, 0x8A, 0x7C, //  103 <g> 
-      5, /*N*/ 0x7F, 0x08, 0x04, 0x04, 0x78, //  104 <h> 
-      3, /*N*/ 0x44, 0x7D, 0x40, 0x00, 0x00, //  105 <i> 
-      4, /*N*/ 0x20, 0x40, 0x44, 0x3D, 0x00, //  106 <j> 
-      4, /*N*/ 0x7F, 0x10, 0x28, 0x44, 0x00, //  107 <k> 
-      3, /*N*/ 0x41, 0x7F, 0x40, 0x00, 0x00, //  108 <l> 
-      5, /*N*/ 0x7C, 0x04, 0x18, 0x04, 0x78, //  109 <m> 
-      5, /*N*/ 0x7C, 0x08, 0x04, 0x04, 0x78, //  110 <n> 
-      5, /*N*/ 0x38, 0x44, 0x44, 0x44, 0x38, //  111 <o> 
-      5, /*N*/ 0x7C, 0x14, 0x14, 0x14, 0x08, //  112 <p> 
-      4, /*N*/ 0x1C, 0x22, 0x22, 0xFC, 0x00, //  113 <q> 
-      5, /*N*/ 0x7C, 0x08, 0x04, 0x04, 0x08, //  114 <r> 
-      4, /*N*/ 0x48, 0x54, 0x54, 0x24, 0x00, //  115 <s> 
-      5, /*N*/ 0x04, 0x3F, 0x44, 0x40, 0x20, //  116 <t> 
-      5, /*N*/ 0x3C, 0x40, 0x40, 0x20, 0x7C, //  117 <u> 
-      5, /*N*/ 0x1C, 0x20, 0x40, 0x20, 0x1C, //  118 <v> 
-      5, /*N*/ 0x3C, 0x40, 0x30, 0x40, 0x3C, //  119 <w> 
-      5, /*N*/ 0x44, 0x28, 0x10, 0x28, 0x44, //  120 <x> 
-      5, /*N*/ 0x0C, 0x50, 0x50, 0x50, 0x3C, //  121 <y> 
-      5, /*N*/ 0x44, 0x64, 0x54, 0x4C, 0x44, //  122 <z> 
-
-      3, /*N*/ 0x08, 0x36, 0x41, 0x00, 0x00, //  123 <{> 
-      1, /*N*/ 0x7F, 0x00, 0x00, 0x00, 0x00, //  124 <|> 
-      3, /*N*/ 0x41, 0x36, 0x08, 0x00, 0x00, //  125 <}> 
-      5, /*N*/ 0x08, 0x04, 0x08, 0x10, 0x08  //  126 <~>  
-};
 
 
-const unsigned char  font_ru_8[FONT_RU_8_ARRAY_LENGTH] =
-{
+//################################### DIGITS 32 ###################################//
 
-      // Cyrillic Capitals / ,  
-      5, /*N*/ 0x7E, 0x11, 0x11, 0x11, 0x7E, //  192 <> 
-      5, /*N*/ 0x7F, 0x49, 0x49, 0x49, 0x33, //  193 <> 
-      5, /*N*/ 0x7F, 0x49, 0x49, 0x49, 0x36, //  194 <> 
-      5, /*N*/ 0x7F, 0x01, 0x01, 0x01, 0x03, //  195 <> 
-      5, /*N*/ 0xE0, 0x51, 0x4F, 0x41, 0xFF, //  196 <> 
-      5, /*N*/ 0x7F, 0x49, 0x49, 0x49, 0x41, //  197 <> 
-      5, /*N*/ 0x77, 0x08, 0x7F, 0x08, 0x77, //  198 <> 
-      5, /*N*/ 0x41, 0x49, 0x49, 0x49, 0x36, //  199 <> 
-      5, /*N*/ 0x7F, 0x10, 0x08, 0x04, 0x7F, //  200 <> 
-      5, /*N*/ 0x7C, 0x21, 0x12, 0x09, 0x7C, //  201 <> 
-      5, /*N*/ 0x7F, 0x08, 0x14, 0x22, 0x41, //  202 <> 
-      5, /*N*/ 0x20, 0x41, 0x3F, 0x01, 0x7F, //  203 <> 
-      5, /*N*/ 0x7F, 0x02, 0x0C, 0x02, 0x7F, //  204 <> 
-      5, /*N*/ 0x7F, 0x08, 0x08, 0x08, 0x7F, //  205 <> 
-      5, /*N*/ 0x3E, 0x41, 0x41, 0x41, 0x3E, //  206 <> 
-      5, /*N*/ 0x7F, 0x01, 0x01, 0x01, 0x7F, //  207 <> 
-      5, /*N*/ 0x7F, 0x09, 0x09, 0x09, 0x06, //  208 <> 
-      5, /*N*/ 0x3E, 0x41, 0x41, 0x41, 0x22, //  209 <> 
-      5, /*N*/ 0x01, 0x01, 0x7F, 0x01, 0x01, //  210 <> 
-      5, /*N*/ 0x47, 0x28, 0x10, 0x08, 0x07, //  211 <> 
-      5, /*N*/ 0x1C, 0x22, 0x7F, 0x22, 0x1C, //  212 <> 
-      5, /*N*/ 0x63, 0x14, 0x08, 0x14, 0x63, //  213 <> 
-      5, /*N*/ 0x7F, 0x40, 0x40, 0x40, 0xFF, //  214 <> 
-      5, /*N*/ 0x07, 0x08, 0x08, 0x08, 0x7F, //  215 <> 
-      5, /*N*/ 0x7F, 0x40, 0x7F, 0x40, 0x7F, //  216 <> 
-      5, /*N*/ 0x7F, 0x40, 0x7F, 0x40, 0xFF, //  217 <> 
-      5, /*N*/ 0x01, 0x7F, 0x48, 0x48, 0x30, //  218 <> 
-      5, /*N*/ 0x7F, 0x48, 0x30, 0x00, 0x7F, //  219 <> 
-      4, /*N*/ 0x7F, 0x48, 0x48, 0x30, 0x00, //  220 <> 
-      5, /*N*/ 0x41, 0x49, 0x49, 0x2A, 0x1C, //  221 <> 
-      5, /*N*/ 0x7F, 0x08, 0x3E, 0x41, 0x3E, //  222 <> 
-      5, /*N*/ 0x46, 0x29, 0x19, 0x09, 0x7F, //  223 <> 
-
-        // Cyrillic Smalls / ,  
-      5, /*N*/ 0x20, 0x54, 0x54, 0x54, 0x78, //  224 <> 
-      5, /*N*/ 0x3C, 0x4A, 0x4A, 0x49, 0x31, //  225 <> 
-      4, /*N*/ 0x7C, 0x54, 0x54, 0x28, 0x00, //  226 <> 
-      4, /*N*/ 0x7C, 0x04, 0x04, 0x04, 0x00, //  227 <> 
-      5, /*N*/ 0xE0, 0x54, 0x4C, 0x44, 0xFC, //  228 <> 
-      5, /*N*/ 0x38, 0x54, 0x54, 0x54, 0x18, //  229 <> 
-      5, /*N*/ 0x6C, 0x10, 0x7C, 0x10, 0x6C, //  230 <> 
-      4, /*N*/ 0x44, 0x54, 0x54, 0x28, 0x00, //  231 <> 
-      5, /*N*/ 0x7C, 0x20, 0x10, 0x08, 0x7C, //  232 <> 
-      5, /*N*/ 0x78, 0x42, 0x24, 0x12, 0x78, //  233 <> 
-      4, /*N*/ 0x7C, 0x10, 0x28, 0x44, 0x00, //  234 <> 
-      4, /*N*/ 0x40, 0x38, 0x04, 0x7C, 0x00, //  235 <> 
-      5, /*N*/ 0x7C, 0x08, 0x10, 0x08, 0x7C, //  236 <> 
-      4, /*N*/ 0x7C, 0x10, 0x10, 0x7C, 0x00, //  237 <> 
-      4, /*N*/ 0x38, 0x44, 0x44, 0x38, 0x00, //  238 <> 
-      4, /*N*/ 0x7C, 0x04, 0x04, 0x7C, 0x00, //  239 <> 
-      4, /*N*/ 0xFC, 0x24, 0x24, 0x18, 0x00, //  240 <> 
-      4, /*N*/ 0x38, 0x44, 0x44, 0x44, 0x00, //  241 <> 
-      5, /*N*/ 0x04, 0x04, 0x7C, 0x04, 0x04, //  242 <> 
-      4, /*N*/ 0x9C, 0xA0, 0xA0, 0x7C, 0x00, //  243 <> 
-      5, /*N*/ 0x38, 0x44, 0xFE, 0x44, 0x38, //  244 <> 
-      5, /*N*/ 0x44, 0x28, 0x10, 0x28, 0x44, //  245 <> 
-      4, /*N*/ 0x7C, 0x40, 0x40, 0xFC, 0x00, //  246 <> 
-      4, /*N*/ 0x0C, 0x10, 0x10, 0x7C, 0x00, //  247 <> 
-      5, /*N*/ 0x7C, 0x40, 0x7C, 0x40, 0x7C, //  248 <> 
-      5, /*N*/ 0x7C, 0x40, 0x7C, 0x40, 0xFC, //  249 <> 
-      5, /*N*/ 0x04, 0x7C, 0x50, 0x50, 0x20, //  250 <> 
-      5, /*N*/ 0x7C, 0x50, 0x20, 0x00, 0x7C, //  251 <> 
-      4, /*N*/ 0x7C, 0x50, 0x50, 0x20, 0x00, //  252 <> 
-      4, /*N*/ 0x44, 0x54, 0x54, 0x38, 0x00, //  253 <> 
-      5, /*N*/ 0x7C, 0x10, 0x38, 0x44, 0x38, //  254 <> 
-      4, /*N*/ 0x48, 0x34, 0x14, 0x7C, 0x00  //  255 <> 
-};
+constexpr unsigned font_dig_32_packed_sz = packed_font_size<FONT_DIG_32_LENGTH, FONT_DIG_32_CHAR_WIDTH, FONT_DIG_32_CHAR_HEIGHT>(font_dig_32);
+constexpr PackedFont<font_dig_32_packed_sz> font_dig_32_packed = pack_font<font_dig_32_packed_sz, FONT_DIG_32_LENGTH, FONT_DIG_32_CHAR_WIDTH, FONT_DIG_32_CHAR_HEIGHT>(font_dig_32);
 
+Font font_dig32 = {SSD1306_FONT_FORMAT::PACKED, FONT_DIG_32_CHAR_WIDTH, FONT_DIG_32_CHAR_HEIGHT, FONT_DIG_32_CHAR_INTERVAL, (void*)font_dig_32_packed.data, ((void*)0), DIGITS_ONLY};
 
-Font font8 = {FONT_8_CHAR_WIDTH, FONT_8_CHAR_HEIGHT, FONT_8_CHAR_INTERVAL, (void*)font_en_8, (void*)font_ru_8};
 
 
 
 
+/*
+ * Scaled fonts. They share data with base fonts and are expanded while drawing
+ */
+Font font8x2 = {font8, 2};
+Font font8x3 = {font8, 3};
+Font font8x4 = {font8, 4};
+Font font16x2 = {font16, 2};
+Font font16x3 = {font16, 3};
+Font font16x4 = {font16, 4};
+
 
-//################################### FONT 16 ###################################//
 
-#define FONT_16_CHAR_WIDTH       10
-#define FONT_16_CHAR_HEIGHT      16
-#define FONT_16_CHAR_INTERVAL    2
 
-#define FONT_EN_16_LENGTH           95
-#define FONT_EN_16_START_CHAR       32
-#define FONT_EN_16_ARRAY_LENGTH     (FONT_EN_16_LENGTH * (1 + FONT_16_CHAR_WIDTH))
 
 
-#define FONT_RU_16_LENGTH           64
-#define FONT_RU_16_START_CHAR       192
-#define FONT_RU_16_ARRAY_LENGTH     (FONT_RU_16_LENGTH * (1 + FONT_16_CHAR_WIDTH))
 
+// UTF-8 sequence length by the first byte (indexed by byte >> 3), 0 - the byte can not start a sequence
+static const uint8_t utf8_seq_len[32] = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                                         0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 3, 3, 4, 0};
 
-const unsigned short font_en_16[FONT_EN_16_ARRAY_LENGTH] =
+// Payload bits of the first byte of UTF-8 sequence (indexed by sequence length)
+static const uint8_t utf8_lead_mask[5] = {0x00, 0x7F, 0x1F, 0x0F, 0x07};
+
+struct CodeRange                                    // code points range which is stored in the font continuously
 {
-        6, /*N*/ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  32  < > 
-        2, /*N*/ 0x0CFF, 0x0CFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  33  <!> 
-        5, /*N*/ 0x0007, 0x0007, 0x0000, 0x0007, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  34  <"> 
-        8, /*N*/ 0x030C, 0x0FFF, 0x0FFF, 0x030C, 0x030C, 0x0FFF, 0x0FFF, 0x030C, 0x0000, 0x0000, //  35  <#> 
-        8, /*N*/ 0x033C, 0x073E, 0x0666, 0x0FFF, 0x0FFF, 0x0666, 0x07E6, 0x03CC, 0x0000, 0x0000, //  36  <$> 
-        7, /*N*/ 0x0C07, 0x0F07, 0x03C7, 0x00F0, 0x0E3C, 0x0E0F, 0x0E03, 0x0000, 0x0000, 0x0000, //  37  <%> 
-        9, /*N*/ 0x0780, 0x0FCE, 0x0C7F, 0x0C71, 0x0CF9, 0x078F, 0x0706, 0x0D80, 0x0CC0, 0x0000, //  38  <&> 
-        2, /*N*/ 0x0007, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  39  <'> 
-        3, /*N*/ 0x07FE, 0x0FFF, 0x0C03, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  40  <(> 
-        3, /*N*/ 0x0C03, 0x0FFF, 0x07FE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  41  <)> 
-        8, /*N*/ 0x0198, 0x01F8, 0x00F0, 0x03FC, 0x03FC, 0x00F0, 0x01F8, 0x0198, 0x0000, 0x0000, //  42  <*> 
-        8, /*N*/ 0x0060, 0x0060, 0x0060, 0x03FC, 0x03FC, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, //  43  <+> 
-        3, /*N*/ 0x3000, 0x3C00, 0x1C00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  44  <,> 
-        8, /*N*/ 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, //  45  <-> 
-        2, /*N*/ 0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  46  <.> 
-        7, /*N*/ 0x0C00, 0x0F00, 0x03C0, 0x00F0, 0x003C, 0x000F, 0x0003, 0x0000, 0x0000, 0x0000, //  47  </> 
-
-        // Digits /  
-        8, /*N*/ 0x07FE, 0x0FFF, 0x0D83, 0x0CC3, 0x0C63, 0x0C33, 0x0FFF, 0x07FE, 0x0000, 0x0000, //  48  <0> 
-        8, /*N*/ 0x0C18, 0x0C1C, 0x0C0E, 0x0FFF, 0x0FFF, 0x0C00, 0x0C00, 0x0C00, 0x0000, 0x0000, //  49  <1> 
-        8, /*N*/ 0x0FC6, 0x0FE7, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0C7F, 0x0C3E, 0x0000, 0x0000, //  50  <2> 
-        8, /*N*/ 0x0606, 0x0E07, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0FFF, 0x079E, 0x0000, 0x0000, //  51  <3> 
-        8, /*N*/ 0x00E0, 0x01F0, 0x01B8, 0x019C, 0x018E, 0x0FFF, 0x0FFF, 0x0180, 0x0000, 0x0000, //  52  <4> 
-        8, /*N*/ 0x063F, 0x0E3F, 0x0C33, 0x0C33, 0x0C33, 0x0C33, 0x0FF3, 0x07E3, 0x0000, 0x0000, //  53  <5> 
-        8, /*N*/ 0x07FE, 0x0FFF, 0x0C33, 0x0C33, 0x0C33, 0x0C33, 0x0FF7, 0x07E6, 0x0000, 0x0000, //  54  <6> 
-        8, /*N*/ 0x0003, 0x0003, 0x0E03, 0x0F83, 0x01E3, 0x007B, 0x001F, 0x0007, 0x0000, 0x0000, //  55  <7> 
-        8, /*N*/ 0x079E, 0x0FFF, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0FFF, 0x079E, 0x0000, 0x0000, //  56  <8> 
-        8, /*N*/ 0x063E, 0x0E7F, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0FFF, 0x07FE, 0x0000, 0x0000, //  57  <9> 
-
-        2, /*N*/ 0x0306, 0x0306, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  58  <:> 
-        3, /*N*/ 0x0600, 0x0706, 0x0306, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  59  <;> 
-        6, /*N*/ 0x0060, 0x00F0, 0x0198, 0x030C, 0x0606, 0x0C03, 0x0000, 0x0000, 0x0000, 0x0000, //  60  <<> 
-        8, /*N*/ 0x01B0, 0x01B0, 0x01B0, 0x01B0, 0x01B0, 0x01B0, 0x01B0, 0x01B0, 0x0000, 0x0000, //  61  <=> 
-        6, /*N*/ 0x0C03, 0x0606, 0x030C, 0x0198, 0x00F0, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, //  62  <>> 
-        8, /*N*/ 0x0006, 0x0007, 0x0003, 0x0DC3, 0x0DE3, 0x0063, 0x003F, 0x001E, 0x0000, 0x0000, //  63  <?> 
-        8, /*N*/ 0x07FE, 0x0FFF, 0x0C03, 0x0CF3, 0x0DFB, 0x0D8B, 0x0DFF, 0x04FE, 0x0000, 0x0000, //  64  <@> 
-
-        // Roman Capitals / ,  
-        8, /*N*/ 0x0FFE, 0x0FFF, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x0FFF, 0x0FFE, 0x0000, 0x0000, //  65  <A> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0FFF, 0x079E, 0x0000, 0x0000, //  66  <B> 
-        8, /*N*/ 0x07FE, 0x0FFF, 0x0C03, 0x0C03, 0x0C03, 0x0C03, 0x0E07, 0x0606, 0x0000, 0x0000, //  67  <C> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x0C03, 0x0C03, 0x0C03, 0x0E07, 0x07FE, 0x03FC, 0x0000, 0x0000, //  68  <D> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0C03, 0x0C03, 0x0000, 0x0000, //  69  <E> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x0063, 0x0063, 0x0063, 0x0063, 0x0003, 0x0003, 0x0000, 0x0000, //  70  <F> 
-        8, /*N*/ 0x07FE, 0x0FFF, 0x0C03, 0x0C03, 0x0CC3, 0x0CC3, 0x0FC7, 0x07C6, 0x0000, 0x0000, //  71  <G> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x0060, 0x0060, 0x0060, 0x0060, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  72  <H> 
-        8, /*N*/ 0x0C03, 0x0C03, 0x0C03, 0x0FFF, 0x0FFF, 0x0C03, 0x0C03, 0x0C03, 0x0000, 0x0000, //  73  <I> 
-        8, /*N*/ 0x0600, 0x0E00, 0x0C00, 0x0C00, 0x0C03, 0x0FFF, 0x07FF, 0x0003, 0x0000, 0x0000, //  74  <J> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x0070, 0x00F8, 0x01DC, 0x038E, 0x0F07, 0x0E03, 0x0000, 0x0000, //  75  <K> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0E00, 0x0E00, 0x0000, 0x0000, //  76  <L> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x000E, 0x001C, 0x001C, 0x000E, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  77  <M> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x001C, 0x0038, 0x0070, 0x00E0, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  78  <N> 
-        8, /*N*/ 0x07FE, 0x0FFF, 0x0C03, 0x0C03, 0x0C03, 0x0C03, 0x0FFF, 0x07FE, 0x0000, 0x0000, //  79  <O> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00FF, 0x007E, 0x0000, 0x0000, //  80  <P> 
-        9, /*N*/ 0x07FE, 0x0FFF, 0x0C03, 0x0C03, 0x0D83, 0x0783, 0x07FF, 0x0FFE, 0x0C00, 0x0000, //  81  <Q> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x00E3, 0x01E3, 0x03E3, 0x0763, 0x0E7F, 0x0C3E, 0x0000, 0x0000, //  82  <R> 
-        8, /*N*/ 0x063E, 0x0E7F, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0FE7, 0x07C6, 0x0000, 0x0000, //  83  <S> 
-        8, /*N*/ 0x0003, 0x0003, 0x0003, 0x0FFF, 0x0FFF, 0x0003, 0x0003, 0x0003, 0x0000, 0x0000, //  84  <T> 
-        8, /*N*/ 0x07FF, 0x0FFF, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0FFF, 0x07FF, 0x0000, 0x0000, //  85  <U> 
-        8, /*N*/ 0x01FF, 0x03FF, 0x0700, 0x0E00, 0x0E00, 0x0700, 0x03FF, 0x01FF, 0x0000, 0x0000, //  86  <V> 
-       10, /*N*/ 0x07FF, 0x0FFF, 0x0C00, 0x0C00, 0x07FE, 0x07FE, 0x0C00, 0x0C00, 0x0FFF, 0x07FF, //  87  <W> 
-        8, /*N*/ 0x0F0F, 0x0F9F, 0x01F8, 0x00F0, 0x00F0, 0x01F8, 0x0F9F, 0x0F0F, 0x0000, 0x0000, //  88  <X> 
-        8, /*N*/ 0x0007, 0x001F, 0x0038, 0x0FF0, 0x0FF0, 0x0038, 0x001F, 0x0007, 0x0000, 0x0000, //  89  <Y> 
-        8, /*N*/ 0x0F07, 0x0F87, 0x0DC3, 0x0CE3, 0x0C73, 0x0C3B, 0x0E1F, 0x0E0F, 0x0000, 0x0000, //  90  <Z> 
-
-        4, /*N*/ 0x0FFF, 0x0FFF, 0x0C03, 0x0C03, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  91  <[> 
-        7, /*N*/ 0x0003, 0x000F, 0x003C, 0x00F0, 0x03C0, 0x0F00, 0x0C00, 0x0000, 0x0000, 0x0000, //  92  <\> 
-        4, /*N*/ 0x0C03, 0x0C03, 0x0FFF, 0x0FFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  93  <]> 
-        8, /*N*/ 0x0018, 0x000C, 0x0006, 0x0003, 0x0003, 0x0006, 0x000C, 0x0018, 0x0000, 0x0000, //  94  <^> 
-        8, /*N*/ 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0000, 0x0000, //  95  <_> 
-        4, /*N*/ 0x0001, 0x0003, 0x0006, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  96  <`> 
-
-        // Roman Smalls / ,  
-        7, /*N*/ 0x0730, 0x0FB0, 0x0DB0, 0x0DB0, 0x0DB0, 0x0FF0, 0x0FE0, 0x0000, 0x0000, 0x0000, //  97  <a> 
-        7, /*N*/ 0x0FFF, 0x0FFF, 0x0C30, 0x0C30, 0x0C30, 0x0FF0, 0x07C0, 0x0000, 0x0000, 0x0000, //  98  <b> 
-        7, /*N*/ 0x07E0, 0x0FF0, 0x0C30, 0x0C30, 0x0C30, 0x0E70, 0x0660, 0x0000, 0x0000, 0x0000, //  99  <c> 
-        7, /*N*/ 0x07E0, 0x0FF0, 0x0C30, 0x0C30, 0x0C30, 0x0FFF, 0x0FFF, 0x0000, 0x0000, 0x0000, //  100 <d> 
-        7, /*N*/ 0x07E0, 0x0FF0, 0x0DB0, 0x0DB0, 0x0DB0, 0x0DF0, 0x05E0, 0x0000, 0x0000, 0x0000, //  101 <e> 
-        7, /*N*/ 0x0030, 0x0FFE, 0x0FFF, 0x0033, 0x0003, 0x0007, 0x0006, 0x0000, 0x0000, 0x0000, //  102 <f> 
-        7, /*N*/ 0x47E0, 0xCFF0, 0xCC30, 0xCC30, 0xCC30, 0xFFF0, 0x7FE0, 0x0000, 0x0000, 0x0000, //  103 <g> 
-        7, /*N*/ 0x0FFF, 0x0FFF, 0x0030, 0x0030, 0x0030, 0x0FF0, 0x0FE0, 0x0000, 0x0000, 0x0000, //  104 <h> 
-        6, /*N*/ 0x0C00, 0x0C10, 0x0FF3, 0x0FF3, 0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000, 0x0000, //  105 <i> 
-        4, /*N*/ 0x6000, 0xC010, 0xFFF3, 0x7FF3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  106 <j> 
-        7, /*N*/ 0x0FFF, 0x0FFF, 0x01C0, 0x03E0, 0x07F0, 0x0E38, 0x0C18, 0x0000, 0x0000, 0x0000, //  107 <k> 
-        6, /*N*/ 0x0C03, 0x0C03, 0x0FFF, 0x0FFF, 0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000, 0x0000, //  108 <l> 
-       10, /*N*/ 0x0FF0, 0x0FF0, 0x0030, 0x0030, 0x0FF0, 0x0FE0, 0x0030, 0x0030, 0x0FF0, 0x0FE0, //  109 <m> 
-        7, /*N*/ 0x0FF0, 0x0FF0, 0x0030, 0x0030, 0x0030, 0x0FF0, 0x0FE0, 0x0000, 0x0000, 0x0000, //  110 <n> 
-        7, /*N*/ 0x07E0, 0x0FF0, 0x0C30, 0x0C30, 0x0C30, 0x0FF0, 0x07E0, 0x0000, 0x0000, 0x0000, //  111 <o> 
-        7, /*N*/ 0xFFF0, 0xFFF0, 0x0C30, 0x0C30, 0x0C30, 0x0FF0, 0x07E0, 0x0000, 0x0000, 0x0000, //  112 <p> 
-        7, /*N*/ 0x07E0, 0x0FF0, 0x0C30, 0x0C30, 0x0C30, 0xFFF0, 0xFFF0, 0x0000, 0x0000, 0x0000, //  113 <q> 
-        7, /*N*/ 0x0FF0, 0x0FF0, 0x0060, 0x0030, 0x0030, 0x0070, 0x0060, 0x0000, 0x0000, 0x0000, //  114 <r> 
-        7, /*N*/ 0x0CE0, 0x0DF0, 0x0DB0, 0x0DB0, 0x0DB0, 0x0FB0, 0x0730, 0x0000, 0x0000, 0x0000, //  115 <s> 
-        7, /*N*/ 0x0030, 0x07FF, 0x0FFF, 0x0C30, 0x0C30, 0x0E00, 0x0600, 0x0000, 0x0000, 0x0000, //  116 <t> 
-        7, /*N*/ 0x07F0, 0x0FF0, 0x0C00, 0x0C00, 0x0C00, 0x0FF0, 0x07F0, 0x0000, 0x0000, 0x0000, //  117 <u> 
-        7, /*N*/ 0x03F0, 0x07F0, 0x0E00, 0x0C00, 0x0E00, 0x07F0, 0x03F0, 0x0000, 0x0000, 0x0000, //  118 <v> 
-        8, /*N*/ 0x07F0, 0x0FF0, 0x0C00, 0x07C0, 0x07C0, 0x0C00, 0x0FF0, 0x07F0, 0x0000, 0x0000, //  119 <w> 
-        7, /*N*/ 0x0C30, 0x0E70, 0x03C0, 0x0180, 0x03C0, 0x0E70, 0x0C30, 0x0000, 0x0000, 0x0000, //  120 <x> 
-        7, /*N*/ 0x07F0, 0xCFF0, 0xCC00, 0xCC00, 0xCC00, 0xFFF0, 0x7FF0, 0x0000, 0x0000, 0x0000, //  121 <y> 
-        7, /*N*/ 0x0C30, 0x0E30, 0x0F30, 0x0DB0, 0x0CF0, 0x0C70, 0x0C30, 0x0000, 0x0000, 0x0000, //  122 <z> 
-
-        4, /*N*/ 0x0060, 0x07FE, 0x0F9F, 0x0C03, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  123 <{> 
-        2, /*N*/ 0x0FFF, 0x0FFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  124 <|> 
-        4, /*N*/ 0x0C03, 0x0F9F, 0x07FE, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, //  125 <}> 
-        8, /*N*/ 0x0060, 0x0070, 0x0030, 0x0070, 0x00E0, 0x00C0, 0x00E0, 0x0060, 0x0000, 0x0000  //  126 <~> 
+    uint16_t first_cp;
+    uint16_t last_cp;
+    uint8_t first_code;                             // glyph code of the first code point
 };
 
+static const CodeRange code_ranges[2] = {{0x0020, 0x007E, 0x20},   // latin part
+                                         {0x0410, 0x044F, 0xC0}};  // cyrillic part
 
-const unsigned short font_ru_16[FONT_RU_16_ARRAY_LENGTH] =
+struct CodeSubstitute                               // symbol which is shown with similar glyph, if the font has no own glyph for it
 {
-        // Cyrillic Capitals / ,  
-        8, /*N*/ 0x0FFC, 0x0FFE, 0x00C7, 0x00C3, 0x00C3, 0x00C7, 0x0FFE, 0x0FFC, 0x0000, 0x0000, //  192 <> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x0C33, 0x0C33, 0x0C33, 0x0C33, 0x0FF3, 0x07E3, 0x0000, 0x0000, //  193 <> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0FFF, 0x079E, 0x0000, 0x0000, //  194 <> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0000, 0x0000, //  195 <> 
-        8, /*N*/ 0x1C00, 0x1FFE, 0x0FFF, 0x0C03, 0x0C03, 0x0FFF, 0x1FFE, 0x1C00, 0x0000, 0x0000, //  196 <> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x0C63, 0x0C63, 0x0C63, 0x0C63, 0x0C03, 0x0C03, 0x0000, 0x0000, //  197 <> 
-       10, /*N*/ 0x0F0F, 0x0F9F, 0x00F0, 0x0060, 0x0FFF, 0x0FFF, 0x0060, 0x00F0, 0x0F9F, 0x0F0F, //  198 <> 
-        8, /*N*/ 0x0606, 0x0E07, 0x0C03, 0x0C63, 0x0C63, 0x0C63, 0x0FFF, 0x079E, 0x0000, 0x0000, //  199 <> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x00C0, 0x0060, 0x0030, 0x0018, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  200 <> 
-        8, /*N*/ 0x0FF8, 0x0FF8, 0x0301, 0x0182, 0x00C2, 0x0061, 0x0FF8, 0x0FF8, 0x0000, 0x0000, //  201 <> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x00F0, 0x01F8, 0x039C, 0x070E, 0x0E07, 0x0C03, 0x0000, 0x0000, //  202 <> 
-        8, /*N*/ 0x0FFC, 0x0FFE, 0x0007, 0x0003, 0x0003, 0x0003, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  203 <> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x000E, 0x003C, 0x003C, 0x000E, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  204 <> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x0060, 0x0060, 0x0060, 0x0060, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  205 <> 
-        8, /*N*/ 0x07FE, 0x0FFF, 0x0C03, 0x0C03, 0x0C03, 0x0C03, 0x0FFF, 0x07FE, 0x0000, 0x0000, //  206 <> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x0003, 0x0003, 0x0003, 0x0003, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  207 <> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00FF, 0x007E, 0x0000, 0x0000, //  208 <> 
-        8, /*N*/ 0x07FE, 0x0FFF, 0x0C03, 0x0C03, 0x0C03, 0x0C03, 0x0E07, 0x0606, 0x0000, 0x0000, //  209 <> 
-        8, /*N*/ 0x0003, 0x0003, 0x0003, 0x0FFF, 0x0FFF, 0x0003, 0x0003, 0x0003, 0x0000, 0x0000, //  210 <> 
-        8, /*N*/ 0x007F, 0x0CFF, 0x0CC0, 0x0CC0, 0x0CC0, 0x0CC0, 0x0FFF, 0x07FF, 0x0000, 0x0000, //  211 <> 
-       10, /*N*/ 0x01FC, 0x03FE, 0x0306, 0x0306, 0x0FFF, 0x0FFF, 0x0306, 0x0306, 0x03FE, 0x01FC, //  212 <> 
-        8, /*N*/ 0x0E07, 0x0F0F, 0x0198, 0x00F0, 0x00F0, 0x0198, 0x0F0F, 0x0E07, 0x0000, 0x0000, //  213 <> 
-        8, /*N*/ 0x0FFF, 0x0FFF, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x3FFF, 0x3FFF, 0x0000, 0x0000, //  214 <> 
-        8, /*N*/ 0x007F, 0x00FF, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  215 <> 
-       10, /*N*/ 0x0FFF, 0x0FFF, 0x0C00, 0x0C00, 0x0FFF, 0x0FFF, 0x0C00, 0x0C00, 0x0FFF, 0x0FFF, //  216 <> 
-       10, /*N*/ 0x0FFF, 0x0FFF, 0x0C00, 0x0C00, 0x0FFF, 0x0FFF, 0x0C00, 0x0C00, 0x3FFF, 0x3FFF, //  217 <> 
-        9, /*N*/ 0x0003, 0x0003, 0x0FFF, 0x0FFF, 0x0C60, 0x0C60, 0x0C60, 0x0FE0, 0x07C0, 0x0000, //  218 <> 
-       10, /*N*/ 0x0FFF, 0x0FFF, 0x0C60, 0x0C60, 0x0C60, 0x0FE0, 0x07C0, 0x0000, 0x0FFF, 0x0FFF, //  219 <> 
-        7, /*N*/ 0x0FFF, 0x0FFF, 0x0C60, 0x0C60, 0x0C60, 0x0FE0, 0x07C0, 0x0000, 0x0000, 0x0000, //  220 <> 
-        7, /*N*/ 0x0C03, 0x0C03, 0x0C63, 0x0C63, 0x0C63, 0x0FFF, 0x07FE, 0x0000, 0x0000, 0x0000, //  221 <> 
-        9, /*N*/ 0x0FFF, 0x0FFF, 0x0060, 0x07FE, 0x0FFF, 0x0C03, 0x0C03, 0x0FFF, 0x07FE, 0x0000, //  222 <> 
-        8, /*N*/ 0x0C7E, 0x0EFF, 0x07C3, 0x03C3, 0x01C3, 0x00C3, 0x0FFF, 0x0FFF, 0x0000, 0x0000, //  223 <> 
-
-        // Cyrillic Smalls / ,  
-        7, /*N*/ 0x0720, 0x0FB0, 0x0DB0, 0x0DB0, 0x0DB0, 0x0FF0, 0x0FE0, 0x0000, 0x0000, 0x0000, //  224 <> 
-        7, /*N*/ 0x07FC, 0x0FFE, 0x0C37, 0x0C33, 0x0C33, 0x0FF3, 0x07E0, 0x0000, 0x0000, 0x0000, //  225 <> 
-        7, /*N*/ 0x0FF0, 0x0FF0, 0x0DB0, 0x0DB0, 0x0DB0, 0x0FF0, 0x0760, 0x0000, 0x0000, 0x0000, //  226 <> 
-        6, /*N*/ 0x0FF0, 0x0FF0, 0x0030, 0x0030, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000, //  227 <> 
-        8, /*N*/ 0x1C00, 0x1FE0, 0x0FF0, 0x0C30, 0x0C30, 0x0FF0, 0x1FE0, 0x1C00, 0x0000, 0x0000, //  228 <> 
-        7, /*N*/ 0x07E0, 0x0FF0, 0x0DB0, 0x0DB0, 0x0DB0, 0x0DF0, 0x05E0, 0x0000, 0x0000, 0x0000, //  229 <> 
-        8, /*N*/ 0x0E70, 0x0FF0, 0x0180, 0x0FF0, 0x0FF0, 0x0180, 0x0FF0, 0x0E70, 0x0000, 0x0000, //  230 <> 
-        7, /*N*/ 0x0C30, 0x0DB0, 0x0DB0, 0x0DB0, 0x0DB0, 0x0FF0, 0x0660, 0x0000, 0x0000, 0x0000, //  231 <> 
-        7, /*N*/ 0x0FF0, 0x0FF0, 0x0300, 0x0180, 0x00C0, 0x0FF0, 0x0FF0, 0x0000, 0x0000, 0x0000, //  232 <> 
-        7, /*N*/ 0x0FF0, 0x0FF0, 0x0304, 0x0188, 0x00C4, 0x0FF0, 0x0FF0, 0x0000, 0x0000, 0x0000, //  233 <> 
-        7, /*N*/ 0x0FF0, 0x0FF0, 0x0180, 0x0180, 0x03C0, 0x0E70, 0x0C30, 0x0000, 0x0000, 0x0000, //  234 <> 
-        7, /*N*/ 0x0FC0, 0x0FE0, 0x0070, 0x0030, 0x0030, 0x0FF0, 0x0FF0, 0x0000, 0x0000, 0x0000, //  235 <> 
-        7, /*N*/ 0x0FF0, 0x0FF0, 0x00E0, 0x01C0, 0x00E0, 0x0FF0, 0x0FF0, 0x0000, 0x0000, 0x0000, //  236 <> 
-        7, /*N*/ 0x0FF0, 0x0FF0, 0x0180, 0x0180, 0x0180, 0x0FF0, 0x0FF0, 0x0000, 0x0000, 0x0000, //  237 <> 
-        7, /*N*/ 0x07E0, 0x0FF0, 0x0C30, 0x0C30, 0x0C30, 0x0FF0, 0x07E0, 0x0000, 0x0000, 0x0000, //  238 <> 
-        7, /*N*/ 0x0FF0, 0x0FF0, 0x0010, 0x0010, 0x0010, 0x0FF0, 0x0FF0, 0x0000, 0x0000, 0x0000, //  239 <> 
-        7, /*N*/ 0xFFF0, 0xFFF0, 0x0C30, 0x0C30, 0x0C30, 0x0FF0, 0x07E0, 0x0000, 0x0000, 0x0000, //  240 <> 
-        7, /*N*/ 0x07E0, 0x0FF0, 0x0C30, 0x0C30, 0x0C30, 0x0E70, 0x0660, 0x0000, 0x0000, 0x0000, //  241 <> 
-        6, /*N*/ 0x0030, 0x0030, 0x0FF0, 0x0FF0, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000, //  242 <> 
-        7, /*N*/ 0x47F0, 0xCFF0, 0xCC00, 0xCC00, 0xCC00, 0xFFF0, 0x7FF0, 0x0000, 0x0000, 0x0000, //  243 <> 
-        8, /*N*/ 0x07E0, 0x0FF0, 0x0C30, 0x1FF8, 0x1FF8, 0x0C30, 0x0FF0, 0x07E0, 0x0000, 0x0000, //  244 <> 
-        7, /*N*/ 0x0C30, 0x0E70, 0x03C0, 0x0180, 0x03C0, 0x0E70, 0x0C30, 0x0000, 0x0000, 0x0000, //  245 <> 
-        7, /*N*/ 0x0FF0, 0x0FF0, 0x0C00, 0x0C00, 0x0C00, 0x3FF0, 0x3FF0, 0x0000, 0x0000, 0x0000, //  246 <> 
-        7, /*N*/ 0x00F0, 0x01F0, 0x0180, 0x0180, 0x0180, 0x0FF0, 0x0FF0, 0x0000, 0x0000, 0x0000, //  247 <> 
-        8, /*N*/ 0x0FF0, 0x0FF0, 0x0C00, 0x0FF0, 0x0FF0, 0x0C00, 0x0FF0, 0x0FF0, 0x0000, 0x0000, //  248 <> 
-        8, /*N*/ 0x0FF0, 0x0FF0, 0x0C00, 0x0FF0, 0x0FF0, 0x0C00, 0x3FF0, 0x3FF0, 0x0000, 0x0000, //  249 <> 
-        7, /*N*/ 0x0010, 0x0FF0, 0x0FF0, 0x0D80, 0x0D80, 0x0F80, 0x0700, 0x0000, 0x0000, 0x0000, //  250 <> 
-        9, /*N*/ 0x0FF0, 0x0FF0, 0x0D80, 0x0D80, 0x0F80, 0x0700, 0x0000, 0x0FF0, 0x0FF0, 0x0000, //  251 <> 
-        6, /*N*/ 0x0FF0, 0x0FF0, 0x0D80, 0x0D80, 0x0F80, 0x0700, 0x0000, 0x0000, 0x0000, 0x0000, //  252 <> 
-        7, /*N*/ 0x0C30, 0x0C30, 0x0DB0, 0x0DB0, 0x0DB0, 0x0FF0, 0x07E0, 0x0000, 0x0000, 0x0000, //  253 <> 
-        8, /*N*/ 0x0FF0, 0x0FF0, 0x0180, 0x07E0, 0x0FF0, 0x0C30, 0x0FF0, 0x07E0, 0x0000, 0x0000, //  254 <> 
-        7, /*N*/ 0x08E0, 0x0DF0, 0x0790, 0x0390, 0x0190, 0x0FF0, 0x0FF0, 0x0000, 0x0000, 0x0000  //  255 <> 
+    uint16_t cp;
+    char code;
 };
 
-Font font16 = {FONT_16_CHAR_WIDTH, FONT_16_CHAR_HEIGHT, FONT_16_CHAR_INTERVAL, (void*)font_en_16, (void*)font_ru_16};
+static const CodeSubstitute code_substitutes[9] = {{0x00A0, ' '}, {0x0401, '\xC5'}, {0x0451, '\xE5'}, {0x2013, '-'}, {0x2014, '-'},
+                                                   {0x2018, '\''}, {0x2019, '\''}, {0x201C, '"'}, {0x201D, '"'}};
 
 
 
 
+/**
+ * @brief Reads one symbol of UTF-8 string and returns its glyph code. Bytes which are not valid UTF-8 sequence 
+ *        are treated as Windows 1251 symbols, so old Windows 1251 strings are shown correctly too
+ * 
+ * @param str                         [in, out] pointer to the string, moved to the next symbol
+ * @return                            glyph code for "get_glyph", "get_symbol_width" and "write_char". 0 - end of the string
+ */
+char Font::read_code(const char** str)
+{
+  const uint8_t* s = (const uint8_t*)*str;
+  uint8_t len = utf8_seq_len[s[0] >> 3];
+  uint32_t cp;
+
+  if(s[0] == 0)
+    return 0;
+
+  if(len == 1)                                      // ASCII
+  {
+    (*str)++;
+    return (char)s[0];
+  }
+
+  if(len)
+  {
+    cp = s[0] & utf8_lead_mask[len];
+
+    for(uint8_t i = 1; i < len; i++)
+    {
+      if((s[i] & 0xC0) != 0x80)                     // not UTF-8
+      {
+        len = 0;
+        break;
+      }
+      cp = (cp << 6) | (s[i] & 0x3F);
+    }
+  }
+
+  if(len == 0)                                      // Windows 1251 symbol
+  {
+    (*str)++;
+
+    if(s[0] >= 0xC0)
+      return (char)s[0];
+
+    cp = cp1251_symbols[s[0] - 0x80];
+  }
+  else
+    *str += len;
 
-//################################### DIGITS 32 ###################################//
+  return get_code(cp);
+}
 
-#define FONT_DIG_32_CHAR_WIDTH      19
-#define FONT_DIG_32_CHAR_HEIGHT     29
-#define FONT_DIG_32_CHAR_INTERVAL    3
 
-#define FONT_DIG_32_LENGTH          10
-#define FONT_DIG_32_START_CHAR      48
-#define FONT_DIG_32_ARRAY_LENGTH     (FONT_DIG_32_LENGTH * (1 + FONT_DIG_32_CHAR_WIDTH))
 
 
-const unsigned long  font_dig_32[FONT_DIG_32_ARRAY_LENGTH] =
+/**
+ * @brief Returns glyph code of the symbol
+ * 
+ * @param code_point                  Unicode code point of the symbol
+ * @return                            glyph code, '?' if the font has no such symbol
+ */
+char Font::get_code(uint32_t code_point)
 {
+  uint8_t lo, hi, mid;
 
-        // Digits /  
-            19, /*N*/ 0x000FFC00, 0x007FFF80, 0x01FFFFE0, 0x03FFFFF8, 0x07E000FC, 0x0E00000E, 0x0C000006, 0x18000003, 0x10000001, 0x10000001, 0x10000001, 0x18000003, 0x0C000002, 0x0E00000E, 0x07E0007C, 0x03FFFFF8, 0x01FFFFF0, 0x007FFFC0, 0x0007FE00, //  48  <0> 
-            11, /*N*/ 0x10000008, 0x1000000C, 0x10000004, 0x1800000E, 0x1FFFFFFE, 0x1FFFFFFF, 0x1FFFFFFF, 0x18000000, 0x10000000, 0x10000000, 0x10000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, //  49  <1> 
-            19, /*N*/ 0x100000C0, 0x18000070, 0x1C000018, 0x1E00001C, 0x1E00000E, 0x1D000006, 0x1C800007, 0x1C400007, 0x1C200007, 0x1C300007, 0x1C180007, 0x1C0C000F, 0x1C06000E, 0x1C03801E, 0x1C00E07C, 0x1C007FFC, 0x1C001FF8, 0x1E0007E0, 0x06000000, //  50  <2> 
-            17, /*N*/ 0x0E000060, 0x0E000030, 0x1E00001C, 0x1E00000E, 0x1C00000E, 0x1C004007, 0x18004007, 0x18006007, 0x18006007, 0x0800F00F, 0x0800F80F, 0x0C01FC1E, 0x0603E7FE, 0x0707E3FC, 0x03FFC0F0, 0x00FF8000, 0x007E0000, 0x00000000, 0x00000000, //  51  <3> 
-            19, /*N*/ 0x001C0000, 0x001F0000, 0x001F8000, 0x001CC000, 0x001C6000, 0x001C3000, 0x001C1C00, 0x001C0E00, 0x001C0300, 0x001C0180, 0x001C00E0, 0x001C0070, 0x001C0038, 0x001C000C, 0x1FFFFFFE, 0x1FFFFFFF, 0x1FFFFFFF, 0x001C0000, 0x001C0000, //  52  <4> 
-            17, /*N*/ 0x0E000000, 0x0E000400, 0x1E000700, 0x1C0007C0, 0x1C0007F0, 0x18000FBC, 0x18000F8F, 0x18000F07, 0x18001F07, 0x08001F07, 0x0C003E07, 0x04007E07, 0x0600FC07, 0x0383F807, 0x01FFF007, 0x007FE007, 0x001F8001, 0x00000000, 0x00000000, //  53  <5> 
-            19, /*N*/ 0x001FC000, 0x00FFF800, 0x01FFFE00, 0x03FFFF80, 0x07803FC0, 0x0E0033E0, 0x0C0030F0, 0x18001070, 0x10001838, 0x1000181C, 0x1000180C, 0x10003806, 0x18003806, 0x0C00F802, 0x0E03F003, 0x07FFF003, 0x03FFE001, 0x00FFC001, 0x003F0001, //  54  <6> 
-            19, /*N*/ 0x00000060, 0x00000018, 0x0000000E, 0x0000000F, 0x00000007, 0x00000007, 0x00000007, 0x18000007, 0x1F000007, 0x0FC00007, 0x01F80007, 0x003F0007, 0x0007E007, 0x0000FC07, 0x00001F87, 0x000007E7, 0x000000FF, 0x0000001F, 0x00000003, //  55  <7> 
-            17, /*N*/ 0x00F001F0, 0x03FC07F8, 0x07FE0FFC, 0x0E071F86, 0x0C019E02, 0x1800BC03, 0x10007C01, 0x1000F801, 0x1000F001, 0x1001F001, 0x1003D001, 0x1807D803, 0x080F8C02, 0x0C1F070E, 0x07FE07FC, 0x03FC03F8, 0x01F800F0, 0x00000000, 0x00000000, //  56  <8> 
-            19, /*N*/ 0x10001F80, 0x10007FF0, 0x1000FFF8, 0x1001FFFC, 0x1801F80E, 0x0803E006, 0x0C038003, 0x0C038001, 0x06030001, 0x07030001, 0x03830001, 0x01C10003, 0x01E10006, 0x00F9800E, 0x007E807C, 0x003FFFF8, 0x000FFFF0, 0x0003FFE0, 0x0000FF00  //  57  <9> 
-};
+  for(uint8_t i = 0; i < sizeof(code_ranges)/sizeof(code_ranges[0]); i++)
+    if(code_point >= code_ranges[i].first_cp && code_point <= code_ranges[i].last_cp)
+      return (char)(code_ranges[i].first_code + (code_point - code_ranges[i].first_cp));
+
+  // binary search in the sorted extra symbols
+  lo = 0;
+  hi = extra_num;
+  while(lo < hi)
+  {
+    mid = (lo + hi) >> 1;
 
-Font font_dig32 = {FONT_DIG_32_CHAR_WIDTH, FONT_DIG_32_CHAR_HEIGHT, FONT_DIG_32_CHAR_INTERVAL, (void*)font_dig_32, ((void*)0), DIGITS_ONLY};
+    if(extra_cps[mid] == code_point)
+      return (char)(FONT_EXTRA_FIRST_CODE + mid);
 
+    if(extra_cps[mid] < code_point)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
 
+  for(uint8_t i = 0; i < sizeof(code_substitutes)/sizeof(code_substitutes[0]); i++)
+    if(code_substitutes[i].cp == code_point)
+      return code_substitutes[i].code;
 
+  return '?';
+}
 
 
 
 
 /**
- * @brief Construct a new Font object
+ * @brief Checks that the font has the symbol: latin code is in the font range (digits only for "DIGITS_ONLY" fonts),
+ *        cyrillic part or extra symbol is present
  * 
- * @param font_width                  max symbol width
- * @param font_heigth                 symbol heigth
- * @param font_interval               intercharacter spacing
- * @param font_en_data_ptr            pointer to latin part of font
- * @param font_ru_data_ptr            pointer to cyrillic part of font
- * @param font_shift                  shift in ASCII table (set "DIGITS_ONLY" value to create only numerical font)
+ * @param c                           glyph code
+ * @return true                       symbol can be drawn
+ * @return false                      symbol is not in the font
  */
-Font::Font(uint8_t font_width, uint8_t font_heigth, uint8_t font_interval, const void* font_en_data_ptr, const void* font_ru_data_ptr, uint8_t font_shift) : 
-width(font_width), height(font_heigth), interval(font_interval), data_en(font_en_data_ptr), data_ru(font_ru_data_ptr), shift(font_shift){}
+bool Font::has_glyph(char c)
+{
+  uint8_t code = (uint8_t)c;
+
+  if(code >= FONT_EXTRA_FIRST_CODE && code < 0xC0)
+    return code - FONT_EXTRA_FIRST_CODE < extra_num;
+
+  if(loader)
+    return true;                                    // the loader decides
+
+  if(code <= 0x7F)
+    return code >= shift && code <= last_en && data_en;
+
+  return data_ru != (const void*)0;
+}
+
+
+
+
+/**
+ * @brief Returns code of the glyph which is drawn for the symbol: the symbol itself, '?' if the font has no such symbol
+ *        or 0 if the font has no '?' too (digits only fonts) - nothing is drawn then
+ */
+uint8_t Font::get_glyph_code(uint8_t code)
+{
+  if(has_glyph(code))
+    return code;
+
+  return has_glyph('?') ? '?' : 0;
+}
 
 
 
@@ -695,12 +297,137 @@ width(font_width), height(font_heigth), interval(font_interval), data_en(font_en
  */
 uint8_t Font::get_symbol_width(char c)
 {
-  if(height <= 8)
-    return (c <= 0x7F) ? ((uint8_t*)(data_en))[(c-shift)*(width+1)] : ((uint8_t*)(data_ru))[(c-192)*(width+1)];
-  else if (height <= 16)
-    return (c <= 0x7F) ? ((uint16_t*)(data_en))[(c-shift)*(width+1)] : ((uint16_t*)(data_ru))[(c-192)*(width+1)];
+  return get_glyph_width((uint8_t)c) * scale;
+}
+
+
+
+
+/**
+ * @brief Return symbol width in font data (scale is not applied)
+ * 
+ * @param code                        symbol code
+ * @return                            symbol width in px
+ */
+uint8_t Font::get_glyph_width(uint8_t code)
+{
+  if(loader)
+    return get_glyph(code).width;
+
+  if((code = get_glyph_code(code)) == 0)
+    return 0;
+
+  if(code >= FONT_EXTRA_FIRST_CODE && code < 0xC0)
+    return ((const uint8_t*)extra_data)[(code - FONT_EXTRA_FIRST_CODE)*(glyph_w + 1)*word_sz];
+
+  if(packed)
+    return *find_packed(code) & PACKED_GLYPH_WIDTH_MASK;
+
+  if(code <= 0x7F)
+    return widths_en ? widths_en[code - shift] : ((const uint8_t*)data_en)[(code - shift)*(glyph_w + 1)*word_sz];
   else
-    return (c <= 0x7F) ? ((uint32_t*)(data_en))[(c-shift)*(width+1)] : ((uint32_t*)(data_ru))[(c-192)*(width+1)];
+    return widths_ru ? widths_ru[code - 192] : ((const uint8_t*)data_ru)[(code - 192)*(glyph_w + 1)*word_sz];
+}
+
+
+
+
+/**
+ * @brief Finds symbol in packed font: jumps to the nearest indexed symbol and skips the symbols after it (up to 7) by their headers
+ * 
+ * @param code                        symbol code (latin or cyrillic), checked by "has_glyph"
+ * @return                            pointer to the packed symbol header
+ */
+const uint8_t* Font::find_packed(uint8_t code)
+{
+  const uint8_t* data = (const uint8_t*)((code <= 0x7F) ? data_en : data_ru);
+  uint8_t idx = (code <= 0x7F) ? code - shift : code - 192;
+  uint8_t block = idx / PACKED_FONT_INDEX_STEP;
+  const uint8_t* p = data + (data[2*block] | (data[2*block + 1] << 8));
+  uint8_t w, bytes, stored, header_sz;
+
+  for(uint8_t i = idx % PACKED_FONT_INDEX_STEP; i; i--)
+  {
+    w = p[0] & PACKED_GLYPH_WIDTH_MASK;
+    header_sz = (p[0] & PACKED_GLYPH_TRIMMED) ? 2 : 1;
+    bytes = (p[0] & PACKED_GLYPH_TRIMMED) ? p[1] >> PACKED_GLYPH_BYTES_POS : word_sz;
+    stored = w;
+
+    if(p[0] & PACKED_GLYPH_REPEATS)
+    {
+      for(uint8_t k = 1; k < w; k++)                // repeated columns are not stored
+        stored -= (p[header_sz + (k >> 3)] >> (k & 7)) & 1;
+      header_sz += (w + 7) / 8;
+    }
+
+    p += header_sz + stored * bytes;
+  }
+
+  return p;
+}
+
+
+
+
+/**
+ * @brief Return symbol of the font: pointer to its columns and its width. 
+ *        Use it to draw symbol column by column without searching the symbol for every column
+ * 
+ * @param c                           symbol
+ * @return                            Glyph
+ */
+Glyph Font::get_glyph(char c)
+{
+  uint8_t code = get_glyph_code((uint8_t)c);
+  const uint8_t* symbol;
+
+  if(code == 0)                                     // no such symbol and no '?' in the font: nothing to draw
+    return Glyph{(const void*)0, 0, word_sz, 0, (const uint8_t*)0, 0, (const uint8_t*)0, 0};
+
+  if(loader)
+  {
+    Glyph glyph = {(const void*)0, 0, word_sz, 0, (const uint8_t*)0, 0, (const uint8_t*)0, 0};
+
+    if(!loader(loader_ctx, code, &glyph) && !loader(loader_ctx, '?', &glyph))
+      glyph.width = 0;                              // nothing to draw
+
+    return glyph;
+  }
+
+  if(packed && (code <= 0x7F || code >= 0xC0))
+  {
+    Glyph glyph = {(const void*)0, 0, word_sz, 0, (const uint8_t*)0, 0, (const uint8_t*)0, 0};
+    const uint8_t* header = find_packed(code);
+
+    glyph.width = header[0] & PACKED_GLYPH_WIDTH_MASK;
+    symbol = header + 1;
+
+    if(header[0] & PACKED_GLYPH_TRIMMED)
+    {
+      glyph.shift = header[1] & PACKED_GLYPH_SHIFT_MASK;
+      glyph.word_sz = header[1] >> PACKED_GLYPH_BYTES_POS;
+      symbol++;
+    }
+
+    if(header[0] & PACKED_GLYPH_REPEATS)
+    {
+      glyph.repeats = symbol;
+      symbol += (glyph.width + 7) / 8;
+    }
+
+    glyph.data = symbol;
+    glyph.next = symbol;
+    return glyph;
+  }
+
+  if(code <= 0x7F)
+    symbol = (const uint8_t*)data_en + (code - shift)*(glyph_w + 1)*word_sz;
+  else if(code < 0xC0)
+    symbol = (const uint8_t*)extra_data + (code - FONT_EXTRA_FIRST_CODE)*(glyph_w + 1)*word_sz;
+  else
+    symbol = (const uint8_t*)data_ru + (code - 192)*(glyph_w + 1)*word_sz;
+
+  return Glyph{symbol + word_sz, get_glyph_width(code), word_sz, 0, (const uint8_t*)0, 0, (const uint8_t*)0, 0};
 }
 
 
@@ -715,10 +442,86 @@ uint8_t Font::get_symbol_width(char c)
  */
 unsigned Font::get_column(char c, uint8_t col)
 {
-  if(height <= 8)
-    return (c <= 0x7F) ? (unsigned)((uint8_t*)data_en)[(c-shift)*(width+1)+1+col] : (unsigned)((uint8_t*)data_ru)[(c-192)*(width+1)+1+col];
-  else if (height <= 16)
-    return (c <= 0x7F) ? (unsigned)((uint16_t*)data_en)[(c-shift)*(width+1)+1+col] : (unsigned)((uint16_t*)data_ru)[(c-192)*(width+1)+1+col];
-  else
-    return (c <= 0x7F) ? (unsigned)((uint32_t*)data_en)[(c-shift)*(width+1)+1+col] : (unsigned)((uint32_t*)data_ru)[(c-192)*(width+1)+1+col];
-}
\ No newline at end of file
+  return get_glyph(c).get_column(col);
+}
+
+
+
+
+/**
+ * @brief Return width of the string in pixels (intercharacter spacing is included, except the last one)
+ * 
+ * @param str                         string (UTF-8 or Windows 1251)
+ * @return                            string width in px
+ */
+uint8_t Font::get_string_width(const char* str)
+{
+  uint8_t size_px = 0;
+  char code;
+
+  if(*str == 0)
+    return 0;
+
+  while((code = read_code(&str)))
+    size_px += get_symbol_width(code) + interval;
+
+  return size_px - interval;
+}
+
+
+
+
+/**
+ * @brief Returns width of the widest string of the table (use it to size boxes and widgets for any language)
+ */
+uint8_t StringTable::get_max_width() const
+{
+  uint8_t max_w = 0;
+
+  for(uint16_t i = 0; i < num; i++)
+    if(widths[i] > max_w)
+      max_w = widths[i];
+
+  return max_w;
+}
+
+
+
+
+/**
+ * @brief Measures strings of the table at run time (strings which are not known at compile time, i.e. read from asset pack).
+ *        Width of multirow string is the width of its widest row
+ * 
+ * @param strs                        strings
+ * @param strings_num                 amount of strings
+ * @param font                        font which the strings are drawn with
+ * @param widths                      [out] string widths, "strings_num" size
+ */
+void StringTable::measure(const char* const* strs, uint16_t strings_num, Font& font, uint8_t* widths)
+{
+  const char* str;
+  uint16_t width, row_w;
+  char code;
+
+  for(uint16_t i = 0; i < strings_num; i++)
+  {
+    str = strs[i];
+    width = row_w = 0;
+
+    while((code = font.read_code(&str)))
+    {
+      if(code == '\n')
+      {
+        row_w = 0;
+        continue;
+      }
+
+      row_w += font.get_symbol_width(code) + font.interval;
+
+      if(row_w - font.interval > width)
+        width = row_w - font.interval;
+    }
+
+    widths[i] = (width > 255) ? 255 : width;
+  }
+}
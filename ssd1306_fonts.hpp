@@ -1,29 +1,778 @@
+#pragma once
+
 #include "stdint.h"
 
 #define DEFAULT_ASCII 32
 #define DIGITS_ONLY 48
 
+#define FONT_EXTRA_FIRST_CODE   0x80                // glyph codes of extra symbols: 0x80 .. 0xBF
+#define FONT_EXTRA_MAX_NUM      64
+
+// Packed glyph header: byte 0 - [trimmed | repeats | width (6 bits)], byte 1 (only if trimmed) - [column bytes (3 bits) | shift (5 bits)]
+#define PACKED_GLYPH_WIDTH_MASK     0x3F
+#define PACKED_GLYPH_REPEATS        0x40
+#define PACKED_GLYPH_TRIMMED        0x80
+#define PACKED_GLYPH_SHIFT_MASK     0x1F
+#define PACKED_GLYPH_BYTES_POS      5
+
+#define PACKED_FONT_INDEX_STEP      8               // packed font index keeps offset of every 8th symbol
+
+
+enum class SSD1306_FONT_FORMAT{                     // font data format
+    RAW,                                            // [width, column 0, .. column W-1] for every symbol, column is 1, 2 or 4 bytes word
+    PACKED                                          // variable length symbols, see "pack_font"
+};
+
+
+struct Glyph                                        // symbol of the font: its columns and width
+{
+    const void* data;                               // pointer to the first column
+    uint8_t width;                                  // symbol width in font data (px), scale of the font is not applied
+    uint8_t word_sz;                                // size of one column (bytes): 1, 2 or 4. Packed glyph: size of stored column 0 .. 4
+    uint8_t shift;                                  // packed glyph: empty rows above the stored column bits
+    const uint8_t* repeats;                         // packed glyph: bit i is set if column i is equal to column i - 1 (may be null)
+
+    // Columns stream state
+    uint8_t col;                                    // next column
+    const uint8_t* next;                            // packed glyph: next stored column
+    unsigned last;                                  // packed glyph: last read column
+
+    /**
+     * @brief Returns the next column of the glyph. Columns are read one by one from the first one,
+     *        packed glyphs are decoded on the fly without glyph buffer
+     */
+    inline unsigned next_column()
+    {
+        if(repeats == (const uint8_t*)0 && next == (const uint8_t*)0)       // raw glyph
+            return get_column(col++);
+
+        if(col == 0 || repeats == (const uint8_t*)0 || !((repeats[col >> 3] >> (col & 7)) & 1))
+        {
+            last = 0;
+            for(uint8_t b = 0; b < word_sz; b++)
+                last |= (unsigned)next[b] << (8*b);
+            last <<= shift;
+            next += word_sz;
+        }
+
+        col++;
+        return last;
+    }
+
+    /**
+     * @brief Returns the column of the glyph. Random access is fast only for raw glyphs, prefer "next_column"
+     */
+    inline unsigned get_column(uint8_t column) const
+    {
+        if(repeats || next)
+        {
+            Glyph g = *this;
+            g.rewind();
+            while(g.col < column)
+                g.next_column();
+            return g.next_column();
+        }
+
+        switch(word_sz)
+        {
+            case 1:  return ((const uint8_t*)data)[column];
+            case 2:  return ((const uint16_t*)data)[column];
+            default: return ((const uint32_t*)data)[column];
+        }
+    }
+
+    inline void rewind()
+    {
+        col = 0;
+        if(next)
+            next = (const uint8_t*)data;
+    }
+};
+
+
+// Loads glyph of the font which is not stored in memory (see "PackFont"). Returns false if there is no such glyph
+typedef bool (*GlyphLoadFunc)(void* ctx, uint8_t code, Glyph* glyph);
+
 
 class Font
 {
     const uint8_t shift;
+    const uint8_t last_en;                          // code of the last latin symbol
     const void *data_en;
     const void *data_ru;
+    const uint8_t *widths_en;                       // precomputed symbol widths (optional)
+    const uint8_t *widths_ru;
+    const uint8_t word_sz;                          // size of one column (bytes)
+    const uint8_t glyph_w;                          // max symbol width in font data (px)
+    const uint16_t *extra_cps;                      // sorted Unicode code points of extra symbols (optional)
+    const void *extra_data;                         // extra symbols, raw format
+    const uint8_t extra_num;
+    const bool packed;                              // latin and cyrillic parts are packed
+    const GlyphLoadFunc loader;                     // glyphs are loaded by function (optional)
+    void* const loader_ctx;
+
+    uint8_t get_glyph_width(uint8_t code);
+    uint8_t get_glyph_code(uint8_t code);
+    const uint8_t* find_packed(uint8_t code);
+    char get_code(uint32_t code_point);
 
     public:
-    const uint8_t width;
+    const uint8_t width;                            // max symbol width, scale is applied to width, height and interval
     const uint8_t height;
     const uint8_t interval;
+    const uint8_t scale;                            // integer scale of font data (1 - native size)
 
 	
-	Font(uint8_t font_width, uint8_t font_heigth, uint8_t font_interval, const void* font_en_data_ptr, const void* font_ru_data_ptr, uint8_t font_shift = DEFAULT_ASCII);
+	constexpr Font(uint8_t font_width, uint8_t font_heigth, uint8_t font_interval, const void* font_en_data_ptr, const void* font_ru_data_ptr, uint8_t font_shift = DEFAULT_ASCII);
+	constexpr Font(uint8_t font_width, uint8_t font_heigth, uint8_t font_interval, const void* font_en_data_ptr, const void* font_ru_data_ptr, const uint8_t* widths_en_ptr, const uint8_t* widths_ru_ptr, uint8_t font_shift = DEFAULT_ASCII);
+	constexpr Font(SSD1306_FONT_FORMAT format, uint8_t font_width, uint8_t font_heigth, uint8_t font_interval, const void* font_en_data_ptr, const void* font_ru_data_ptr, uint8_t font_shift = DEFAULT_ASCII);
+	constexpr Font(uint8_t font_width, uint8_t font_heigth, uint8_t font_interval, GlyphLoadFunc glyph_loader, void* glyph_loader_ctx, const uint16_t* extra_code_points, uint8_t extra_symbols_num);
+	constexpr Font(const Font& base_font, uint8_t font_scale);
+	constexpr Font(const Font& base_font, const uint16_t* extra_code_points, const void* extra_data_ptr, uint8_t extra_symbols_num);
 
+	bool has_glyph(char c);
 	uint8_t get_symbol_width(char c);
 	unsigned get_column(char c, uint8_t col);
+	Glyph get_glyph(char c);
+	uint8_t get_string_width(const char* str);
+	char read_code(const char** str);
 };
 
+
+
+/**
+ * @brief Construct a new Font object
+ * 
+ * @param font_width                  max symbol width
+ * @param font_heigth                 symbol heigth
+ * @param font_interval               intercharacter spacing
+ * @param font_en_data_ptr            pointer to latin part of font
+ * @param font_ru_data_ptr            pointer to cyrillic part of font
+ * @param font_shift                  shift in ASCII table (set "DIGITS_ONLY" value to create only numerical font)
+ */
+constexpr Font::Font(uint8_t font_width, uint8_t font_heigth, uint8_t font_interval, const void* font_en_data_ptr, const void* font_ru_data_ptr, uint8_t font_shift) : 
+Font(font_width, font_heigth, font_interval, font_en_data_ptr, font_ru_data_ptr, (uint8_t*)0, (uint8_t*)0, font_shift){}
+
+
+
+
+/**
+ * @brief Construct a new Font object with precomputed symbol widths tables (see "font_widths")
+ * 
+ * @param font_width                  max symbol width
+ * @param font_heigth                 symbol heigth
+ * @param font_interval               intercharacter spacing
+ * @param font_en_data_ptr            pointer to latin part of font
+ * @param font_ru_data_ptr            pointer to cyrillic part of font
+ * @param widths_en_ptr               pointer to widths table of latin part of font
+ * @param widths_ru_ptr               pointer to widths table of cyrillic part of font
+ * @param font_shift                  shift in ASCII table (set "DIGITS_ONLY" value to create only numerical font)
+ */
+constexpr Font::Font(uint8_t font_width, uint8_t font_heigth, uint8_t font_interval, const void* font_en_data_ptr, const void* font_ru_data_ptr, const uint8_t* widths_en_ptr, const uint8_t* widths_ru_ptr, uint8_t font_shift) : 
+shift(font_shift), last_en((font_shift == DIGITS_ONLY) ? '9' : 0x7E), data_en(font_en_data_ptr), data_ru(font_ru_data_ptr), widths_en(widths_en_ptr), widths_ru(widths_ru_ptr), 
+word_sz((font_heigth <= 8) ? 1 : ((font_heigth <= 16) ? 2 : 4)), glyph_w(font_width), extra_cps((uint16_t*)0), extra_data((void*)0), extra_num(0), packed(false),
+loader((GlyphLoadFunc)0), loader_ctx((void*)0),
+width(font_width), height(font_heigth), interval(font_interval), scale(1){}
+
+
+
+
+/**
+ * @brief Construct a new Font object from raw or packed data (see "pack_font"). Symbol widths of packed font are read from its data
+ * 
+ * @param format                      data format SSD1306_FONT_FORMAT:: [RAW, PACKED]
+ * @param font_width                  max symbol width
+ * @param font_heigth                 symbol heigth
+ * @param font_interval               intercharacter spacing
+ * @param font_en_data_ptr            pointer to latin part of font
+ * @param font_ru_data_ptr            pointer to cyrillic part of font
+ * @param font_shift                  shift in ASCII table (set "DIGITS_ONLY" value to create only numerical font)
+ */
+constexpr Font::Font(SSD1306_FONT_FORMAT format, uint8_t font_width, uint8_t font_heigth, uint8_t font_interval, const void* font_en_data_ptr, const void* font_ru_data_ptr, uint8_t font_shift) : 
+shift(font_shift), last_en((font_shift == DIGITS_ONLY) ? '9' : 0x7E), data_en(font_en_data_ptr), data_ru(font_ru_data_ptr), widths_en((uint8_t*)0), widths_ru((uint8_t*)0), 
+word_sz((font_heigth <= 8) ? 1 : ((font_heigth <= 16) ? 2 : 4)), glyph_w(font_width), extra_cps((uint16_t*)0), extra_data((void*)0), extra_num(0), 
+packed(format == SSD1306_FONT_FORMAT::PACKED), loader((GlyphLoadFunc)0), loader_ctx((void*)0),
+width(font_width), height(font_heigth), interval(font_interval), scale(1){}
+
+
+
+
+/**
+ * @brief Construct a new Font object which glyphs are loaded by function (from external storage, see "PackFont").
+ *        Glyph returned by the loader must stay valid until the next glyph is loaded
+ * 
+ * @param font_width                  max symbol width
+ * @param font_heigth                 symbol heigth
+ * @param font_interval               intercharacter spacing
+ * @param glyph_loader                glyph load function
+ * @param glyph_loader_ctx            context of the load function
+ * @param extra_code_points           sorted Unicode code points of extra symbols (glyph codes 0x80 + index), may be null
+ * @param extra_symbols_num           amount of extra symbols
+ */
+constexpr Font::Font(uint8_t font_width, uint8_t font_heigth, uint8_t font_interval, GlyphLoadFunc glyph_loader, void* glyph_loader_ctx, const uint16_t* extra_code_points, uint8_t extra_symbols_num) : 
+shift(DEFAULT_ASCII), last_en(0x7E), data_en((void*)0), data_ru((void*)0), widths_en((uint8_t*)0), widths_ru((uint8_t*)0), 
+word_sz((font_heigth <= 8) ? 1 : ((font_heigth <= 16) ? 2 : 4)), glyph_w(font_width), extra_cps(extra_code_points), extra_data((void*)0), 
+extra_num(extra_symbols_num > FONT_EXTRA_MAX_NUM ? FONT_EXTRA_MAX_NUM : extra_symbols_num), packed(false), loader(glyph_loader), loader_ctx(glyph_loader_ctx),
+width(font_width), height(font_heigth), interval(font_interval), scale(1){}
+
+
+
+
+/**
+ * @brief Construct a scaled copy of the font. It shares font data with the base font, so it costs no flash: "Font font16x2(font16, 2);"
+ *        Glyph columns are expanded while drawing. Scaled font height must not exceed 64 px
+ * 
+ * @param base_font                   font to be scaled
+ * @param font_scale                  integer scale (2 - double size)
+ */
+constexpr Font::Font(const Font& base_font, uint8_t font_scale) : 
+shift(base_font.shift), last_en(base_font.last_en), data_en(base_font.data_en), data_ru(base_font.data_ru), widths_en(base_font.widths_en), widths_ru(base_font.widths_ru), 
+word_sz(base_font.word_sz), glyph_w(base_font.glyph_w), extra_cps(base_font.extra_cps), extra_data(base_font.extra_data), extra_num(base_font.extra_num),
+packed(base_font.packed), loader(base_font.loader), loader_ctx(base_font.loader_ctx),
+width(base_font.width * font_scale), height(base_font.height * font_scale), interval(base_font.interval * font_scale), scale(base_font.scale * font_scale){}
+
+
+
+
+/**
+ * @brief Construct a copy of the font with extra symbols (degree, micro, arrows...). Only the symbols which are needed are stored:
+ *        "extra_code_points" is a sorted list of their Unicode code points, "extra_data_ptr" holds their columns in the same order
+ *        in raw format (as "RAW" latin part of the base font). Extra symbols get glyph codes 0x80 + index (see "read_code")
+ * 
+ * @param base_font                   font to be extended (its own extra symbols are replaced)
+ * @param extra_code_points           sorted Unicode code points of extra symbols
+ * @param extra_data_ptr              pointer to extra symbols data
+ * @param extra_symbols_num           amount of extra symbols (up to FONT_EXTRA_MAX_NUM)
+ */
+constexpr Font::Font(const Font& base_font, const uint16_t* extra_code_points, const void* extra_data_ptr, uint8_t extra_symbols_num) : 
+shift(base_font.shift), last_en(base_font.last_en), data_en(base_font.data_en), data_ru(base_font.data_ru), widths_en(base_font.widths_en), widths_ru(base_font.widths_ru), 
+word_sz(base_font.word_sz), glyph_w(base_font.glyph_w), extra_cps(extra_code_points), extra_data(extra_data_ptr), 
+extra_num(extra_symbols_num > FONT_EXTRA_MAX_NUM ? FONT_EXTRA_MAX_NUM : extra_symbols_num), packed(base_font.packed),
+loader(base_font.loader), loader_ctx(base_font.loader_ctx),
+width(base_font.width), height(base_font.height), interval(base_font.interval), scale(base_font.scale){}
+
+
+
+class MeasuredString                                // string with cached width. Use it for strings which are drawn many times
+{
+    public:
+    const char* const str;
+    Font& font;
+    const uint8_t width_px;                         // string width in font (px)
+
+    MeasuredString(const char* string, Font& string_font) : str(string), font(string_font), width_px(string_font.get_string_width(string)){}
+    MeasuredString(const char* string, Font& string_font, uint8_t string_width) : str(string), font(string_font), width_px(string_width){}
+};
+
+
+
+
+class StringTable                                   // strings of one language with widths measured in the table font (see "string_widths")
+{
+    const char* const* const strs;
+    const uint8_t* const widths;
+
+    public:
+    Font& font;
+    const uint16_t num;
+
+    StringTable(const char* const* table_strs, const uint8_t* table_widths, uint16_t strings_num, Font& table_font) : 
+    strs(table_strs), widths(table_widths), font(table_font), num(strings_num){}
+
+    inline const char* get_str(uint16_t id) const {return (id < num) ? strs[id] : "";}
+    inline uint8_t get_width(uint16_t id) const {return (id < num) ? widths[id] : 0;}
+    inline MeasuredString get(uint16_t id) const {return MeasuredString(get_str(id), font, get_width(id));}
+    uint8_t get_max_width() const;
+
+    static void measure(const char* const* strs, uint16_t strings_num, Font& font, uint8_t* widths);
+};
+
+
+
+
+class StringCatalog                                 // the same strings in several languages. Language is switched by table swap, nothing is measured
+{
+    const StringTable* const* const tables;
+    const uint8_t tables_num;
+    uint8_t lang;                                   // current language (table index)
+
+    public:
+    StringCatalog(const StringTable* const* lang_tables, uint8_t lang_tables_num) : tables(lang_tables), tables_num(lang_tables_num), lang(0){}
+
+    inline void set_language(uint8_t language){if(language < tables_num) lang = language;}
+    inline uint8_t get_language() const {return lang;}
+    inline const StringTable& table() const {return *tables[lang];}
+
+    inline const char* get_str(uint16_t id) const {return tables[lang]->get_str(id);}
+    inline uint8_t get_width(uint16_t id) const {return tables[lang]->get_width(id);}
+    inline MeasuredString get(uint16_t id) const {return tables[lang]->get(id);}
+};
+
+
+
+
+// Table of symbol widths, filled at compile time from the font array
+template<unsigned N>
+struct FontWidths
+{
+    uint8_t w[N];
+};
+
+
+/**
+ * @brief Extracts symbol widths from the font array at compile time. The font array must be "constexpr"
+ * 
+ * @tparam N                          amount of symbols in the font array
+ * @tparam W                          max symbol width (FONT_*_CHAR_WIDTH)
+ * @param font                        font array: [width, column 0, .. column W-1] for every symbol
+ * @return                            widths table, pass it to Font constructor
+ */
+template<unsigned N, uint8_t W, typename T, unsigned L>
+constexpr FontWidths<N> font_widths(const T (&font)[L])
+{
+    static_assert(L >= N * (W + 1), "font array is smaller than N symbols");
+
+    FontWidths<N> widths{};
+
+    for(unsigned i = 0; i < N; i++)
+        widths.w[i] = (uint8_t)font[i * (W + 1)];
+
+    return widths;
+}
+
+
+
+
+// Packed font data, filled at compile time from the font array
+template<unsigned SIZE>
+struct PackedFont
+{
+    uint8_t data[SIZE];
+};
+
+
+/**
+ * @brief Packs one symbol of the font array. Columns are stored only up to the symbol width, empty rows above and below
+ *        the symbol are trimmed (column is stored by 0 .. 4 bytes), columns equal to the previous one are marked by "repeats" bits
+ *        and not stored. Every option is used only if it makes the symbol smaller
+ * 
+ * @param symbol                      symbol in font array: [width, column 0, .. column W-1]
+ * @param word_sz                     size of raw column (bytes): 1, 2 or 4
+ * @param out                         packed symbol output, may be null to get the size only
+ * @return                            packed symbol size (bytes)
+ */
+template<typename T>
+constexpr unsigned pack_glyph(const T* symbol, uint8_t word_sz, uint8_t* out)
+{
+    uint8_t width = (uint8_t)symbol[0];
+    uint32_t all = 0;
+    uint64_t repeats = 0;
+    uint8_t repeats_num = 0;
+    uint8_t shift = 0;
+    uint8_t hi = 31;
+    uint8_t bytes = 0;
+    unsigned pos = 0;
+
+    for(uint8_t k = 0; k < width; k++)
+    {
+        all |= (uint32_t)symbol[1 + k];
+        if(k && (uint32_t)symbol[1 + k] == (uint32_t)symbol[k])
+        {
+            repeats |= (uint64_t)1 << k;
+            repeats_num++;
+        }
+    }
+
+    if(all)
+    {
+        while(!((all >> shift) & 1))
+            shift++;
+        while(!((all >> hi) & 1))
+            hi--;
+        bytes = (hi - shift) / 8 + 1;
+    }
+
+    const bool trimmed = (bytes < word_sz);
+    if(!trimmed)
+    {
+        shift = 0;
+        bytes = word_sz;
+    }
+
+    const uint8_t repeats_sz = (width + 7) / 8;
+    const bool use_repeats = (repeats_num * bytes > repeats_sz);
+
+    if(out)
+    {
+        out[pos] = width | (use_repeats ? PACKED_GLYPH_REPEATS : 0) | (trimmed ? PACKED_GLYPH_TRIMMED : 0);
+        pos++;
+
+        if(trimmed)
+        {
+            out[pos] = shift | (bytes << PACKED_GLYPH_BYTES_POS);
+            pos++;
+        }
+
+        for(uint8_t i = 0; use_repeats && i < repeats_sz; i++, pos++)
+            out[pos] = (uint8_t)(repeats >> (8*i));
+
+        for(uint8_t k = 0; k < width; k++)
+        {
+            if(use_repeats && ((repeats >> k) & 1))
+                continue;
+
+            for(uint8_t b = 0; b < bytes; b++, pos++)
+                out[pos] = (uint8_t)(((uint32_t)symbol[1 + k] >> shift) >> (8*b));
+        }
+    }
+
+    return 1 + (trimmed ? 1 : 0) + (use_repeats ? repeats_sz : 0) + (width - (use_repeats ? repeats_num : 0)) * bytes;
+}
+
+
+/**
+ * @brief Returns size of the packed font, use it as "SIZE" parameter of "pack_font"
+ * 
+ * @tparam N                          amount of symbols in the font array
+ * @tparam W                          max symbol width (FONT_*_CHAR_WIDTH)
+ * @tparam H                          symbol height (FONT_*_CHAR_HEIGHT)
+ * @param font                        font array: [width, column 0, .. column W-1] for every symbol
+ * @return                            packed font size (bytes)
+ */
+template<unsigned N, uint8_t W, uint8_t H, typename T, unsigned L>
+constexpr unsigned packed_font_size(const T (&font)[L])
+{
+    static_assert(L >= N * (W + 1), "font array is smaller than N symbols");
+    static_assert(W <= PACKED_GLYPH_WIDTH_MASK && H <= 32, "font is too big to be packed");
+
+    unsigned size = 2 * ((N + PACKED_FONT_INDEX_STEP - 1) / PACKED_FONT_INDEX_STEP);
+
+    for(unsigned i = 0; i < N; i++)
+        size += pack_glyph(&font[i * (W + 1)], (H <= 8) ? 1 : ((H <= 16) ? 2 : 4), (uint8_t*)0);
+
+    return size;
+}
+
+
+/**
+ * @brief Packs the font array at compile time. The font array must be "constexpr", it is not linked if only the packed font is used.
+ *        Packed font: index (little endian offset of every 8th symbol) and variable length symbols (see "pack_glyph").
+ *        Pass it to Font constructor with SSD1306_FONT_FORMAT::PACKED
+ * 
+ * @tparam SIZE                       packed font size ("packed_font_size")
+ * @tparam N                          amount of symbols in the font array
+ * @tparam W                          max symbol width (FONT_*_CHAR_WIDTH)
+ * @tparam H                          symbol height (FONT_*_CHAR_HEIGHT)
+ * @param font                        font array: [width, column 0, .. column W-1] for every symbol
+ * @return                            packed font
+ */
+template<unsigned SIZE, unsigned N, uint8_t W, uint8_t H, typename T, unsigned L>
+constexpr PackedFont<SIZE> pack_font(const T (&font)[L])
+{
+    static_assert(L >= N * (W + 1), "font array is smaller than N symbols");
+    static_assert(W <= PACKED_GLYPH_WIDTH_MASK && H <= 32, "font is too big to be packed");
+
+    PackedFont<SIZE> packed{};
+    unsigned pos = 2 * ((N + PACKED_FONT_INDEX_STEP - 1) / PACKED_FONT_INDEX_STEP);
+
+    for(unsigned i = 0; i < N; i++)
+    {
+        if(i % PACKED_FONT_INDEX_STEP == 0)
+        {
+            packed.data[2 * (i / PACKED_FONT_INDEX_STEP)] = (uint8_t)pos;
+            packed.data[2 * (i / PACKED_FONT_INDEX_STEP) + 1] = (uint8_t)(pos >> 8);
+        }
+
+        pos += pack_glyph(&font[i * (W + 1)], (H <= 8) ? 1 : ((H <= 16) ? 2 : 4), packed.data + pos);
+    }
+
+    return packed;
+}
+
+// Raw font arrays which are visible at compile time (see ssd1306_font_tables.hpp), used to rasterize static labels
+template<typename T>
+struct FontTables
+{
+    const T* en;                                    // latin symbols from "shift" code
+    const T* ru;                                    // cyrillic symbols 192 .. 255 (may be null)
+    const T* extra;                                 // extra symbols (may be null)
+    const uint16_t* extra_cps;                      // sorted code points of extra symbols
+    uint8_t en_num;
+    uint8_t ru_num;
+    uint8_t extra_num;
+    uint8_t glyph_w;                                // max symbol width (FONT_*_CHAR_WIDTH)
+    uint8_t height;
+    uint8_t interval;
+    uint8_t shift;
+};
+
+
+struct StaticLabel                                  // string rasterized at compile time, see "SSD1306_STATIC_LABEL"
+{
+    const uint8_t* data;                            // page-major pixels
+    uint8_t w;                                      // label width (px)
+    uint8_t h;                                      // label height (px) = font height
+};
+
+
+// Storage for pixels of the static label
+template<uint8_t W, uint8_t H>
+struct LabelData
+{
+    uint8_t data[W ? ((H + 7) / 8) * W : 1];
+};
+
+
+// Unicode code points of Windows 1251 symbols 0x80 .. 0xBF (cyrillic letters 0xC0 .. 0xFF map to U+0410 .. U+044F),
+// used by "Font::read_code" and "label_read_code"
+constexpr uint16_t cp1251_symbols[64] =
+{
+    0x0402, 0x0403, 0x201A, 0x0453, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x20AC, 0x2030, 0x0409, 0x2039, 0x040A, 0x040C, 0x040B, 0x040F,
+    0x0452, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x0000, 0x2122, 0x0459, 0x203A, 0x045A, 0x045C, 0x045B, 0x045F,
+    0x00A0, 0x040E, 0x045E, 0x0408, 0x00A4, 0x0490, 0x00A6, 0x00A7,
+    0x0401, 0x00A9, 0x0404, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x0407,
+    0x00B0, 0x00B1, 0x0406, 0x0456, 0x0491, 0x00B5, 0x00B6, 0x00B7,
+    0x0451, 0x2116, 0x0454, 0x00BB, 0x0458, 0x0405, 0x0455, 0x0457
+};
+
+
+/**
+ * @brief Reads one symbol of the string at compile time and returns its glyph code, as "Font::read_code" does.
+ *        Windows 1251 symbols 0x80 .. 0xBF which are not UTF-8 are decoded by "cp1251_symbols" too
+ * 
+ * @param f                           font tables
+ * @param str                         string
+ * @param pos                         [in, out] position in the string, moved to the next symbol
+ * @return                            glyph code, 0 - end of the string
+ */
+template<typename T>
+constexpr uint8_t label_read_code(const FontTables<T>& f, const char* str, unsigned& pos)
+{
+    const uint8_t b = (uint8_t)str[pos];
+    const uint8_t len = (b < 0x80) ? 1 : ((b >= 0xC0 && b < 0xE0) ? 2 : ((b >= 0xE0 && b < 0xF0) ? 3 : ((b >= 0xF0 && b < 0xF8) ? 4 : 0)));
+    uint32_t cp = b & ((len == 2) ? 0x1F : ((len == 3) ? 0x0F : 0x07));
+    uint8_t i = 1;
+
+    if(b == 0)
+        return 0;
+
+    if(len == 1)
+    {
+        pos++;
+        return b;
+    }
+
+    for(; len && i < len; i++)
+    {
+        if(((uint8_t)str[pos + i] & 0xC0) != 0x80)
+            break;
+        cp = (cp << 6) | ((uint8_t)str[pos + i] & 0x3F);
+    }
+
+    if(len == 0 || i < len)                         // Windows 1251 symbol
+    {
+        pos++;
+
+        if(b >= 0xC0)
+            return b;
+
+        cp = cp1251_symbols[b - 0x80];
+    }
+    else
+        pos += len;
+
+    if(cp >= 0x20 && cp <= 0x7E)
+        return (uint8_t)cp;
+    if(cp >= 0x0410 && cp <= 0x044F)
+        return (uint8_t)(0xC0 + (cp - 0x0410));
+
+    for(uint8_t k = 0; k < f.extra_num; k++)
+        if(f.extra_cps[k] == cp)
+            return FONT_EXTRA_FIRST_CODE + k;
+
+    switch(cp)                                      // the same substitutes as "Font::get_code" uses
+    {
+        case 0x00A0: return ' ';
+        case 0x0401: return 0xC5;
+        case 0x0451: return 0xE5;
+        case 0x2013: case 0x2014: return '-';
+        case 0x2018: case 0x2019: return '\'';
+        case 0x201C: case 0x201D: return '"';
+        default: return '?';
+    }
+}
+
+
+/**
+ * @brief Returns symbol of the font array ([width, column 0, .. column W-1]) at compile time, "?" symbol if there is no such one
+ */
+template<typename T>
+constexpr const T* label_symbol(const FontTables<T>& f, uint8_t code)
+{
+    for(uint8_t attempt = 0; attempt < 2; attempt++, code = '?')
+    {
+        if(code >= f.shift && code < 0x80 && code - f.shift < f.en_num)
+            return f.en + (code - f.shift) * (f.glyph_w + 1);
+        if(code >= FONT_EXTRA_FIRST_CODE && code < 0xC0 && f.extra && code - FONT_EXTRA_FIRST_CODE < f.extra_num)
+            return f.extra + (code - FONT_EXTRA_FIRST_CODE) * (f.glyph_w + 1);
+        if(code >= 0xC0 && f.ru && code - 0xC0 < f.ru_num)
+            return f.ru + (code - 0xC0) * (f.glyph_w + 1);
+    }
+
+    return (const T*)0;
+}
+
+
+/**
+ * @brief Returns width of the string at compile time (the same as "Font::get_string_width")
+ */
+template<typename T>
+constexpr unsigned string_width(const FontTables<T>& f, const char* str)
+{
+    unsigned width = 0;
+    unsigned pos = 0;
+    uint8_t code = 0;
+
+    while((code = label_read_code(f, str, pos)))
+    {
+        const T* symbol = label_symbol(f, code);
+        width += (symbol ? (unsigned)symbol[0] : 0) + f.interval;
+    }
+
+    return width ? width - f.interval : 0;
+}
+
+
+template<typename T, unsigned N>
+constexpr unsigned label_width(const FontTables<T>& f, const char (&str)[N])
+{
+    return string_width(f, (const char*)str);
+}
+
+
+/**
+ * @brief Returns width of the widest row of the string at compile time (rows are separated by '\n')
+ */
+template<typename T>
+constexpr unsigned text_width(const FontTables<T>& f, const char* str)
+{
+    unsigned width = 0;
+    unsigned row_w = 0;
+    unsigned pos = 0;
+    uint8_t code = 0;
+
+    while((code = label_read_code(f, str, pos)))
+    {
+        if(code == '\n')
+        {
+            row_w = 0;
+            continue;
+        }
+
+        const T* symbol = label_symbol(f, code);
+        row_w += (symbol ? (unsigned)symbol[0] : 0) + f.interval;
+
+        if(row_w - f.interval > width)
+            width = row_w - f.interval;
+    }
+
+    return width;
+}
+
+
+// Widths of the string table, filled at compile time
+template<unsigned N>
+struct StringWidths
+{
+    uint8_t w[N];
+};
+
+
+/**
+ * @brief Measures strings of the table at compile time. Width of multirow string is the width of its widest row.
+ *        Widths are limited by 255 px
+ * 
+ * @param f                           font tables
+ * @param strs                        "constexpr" array of string literals
+ * @param scale                       (optional, def = 1) scale of the font which the strings are drawn with
+ * @return                            string widths, use them with "StringTable"
+ */
+template<typename T, unsigned N>
+constexpr StringWidths<N> string_widths(const FontTables<T>& f, const char* const (&strs)[N], uint8_t scale = 1)
+{
+    StringWidths<N> widths{};
+
+    for(unsigned i = 0; i < N; i++)
+    {
+        unsigned w = text_width(f, strs[i]) * scale;
+        widths.w[i] = (w > 255) ? 255 : (uint8_t)w;
+    }
+
+    return widths;
+}
+
+
+/**
+ * @brief Rasterizes the string into page-major pixels at compile time. The font arrays must be "constexpr"
+ * 
+ * @tparam W                          label width, "label_width" of the string
+ * @tparam H                          font height
+ * @param f                           font tables
+ * @param str                         string literal (UTF-8 or Windows 1251)
+ * @return                            label pixels, draw them with "DispSegment::write_label"
+ */
+template<uint8_t W, uint8_t H, typename T, unsigned N>
+constexpr LabelData<W, H> rasterize_label(const FontTables<T>& f, const char (&str)[N])
+{
+    static_assert(H <= 32, "font is too high");
+
+    LabelData<W, H> label{};
+    unsigned x = 0;
+    unsigned pos = 0;
+    uint8_t code = 0;
+
+    while(pos < N && (code = label_read_code(f, str, pos)))
+    {
+        const T* symbol = label_symbol(f, code);
+        const uint8_t width = symbol ? (uint8_t)symbol[0] : 0;
+
+        for(uint8_t c = 0; c < width && x + c < W; c++)
+            for(uint8_t pg = 0; pg < (H + 7) / 8; pg++)
+                label.data[pg * W + x + c] = (uint8_t)((uint32_t)symbol[1 + c] >> (8 * pg));
+
+        x += width + f.interval;
+    }
+
+    return label;
+}
+
+
+/*
+ * Defines static label "name" (StaticLabel) - the string rasterized at compile time, and its width "name_width".
+ * Only pixels are linked, drawing is one blit:
+ *
+ *   SSD1306_STATIC_LABEL(lbl_speed, font8_tables, "Speed:");
+ *   segment->draw_param(ROW2, lbl_speed, font8, speed);
+ */
+#define SSD1306_STATIC_LABEL(name, tables, str)                                                                                     \
+    static constexpr uint8_t name##_width{label_width(tables, str)};                                                              \
+    static constexpr LabelData<name##_width, (tables).height> name##_data = rasterize_label<name##_width, (tables).height>(tables, str); \
+    static constexpr StaticLabel name = {name##_data.data, name##_width, (tables).height}
+
+
+
+
 extern Font font5;
 extern Font font8;
 extern Font font16;
 
 extern Font font_dig32;
+
+extern Font font8x2;
+extern Font font8x3;
+extern Font font8x4;
+extern Font font16x2;
+extern Font font16x3;
+extern Font font16x4;
@@ -0,0 +1,107 @@
+#include "ssd1306_format.hpp"
+
+
+static const uint32_t pow10_table[10] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+
+
+
+/**
+ * @brief Construct a new Num Formatter
+ *
+ * @param value                       number to be formatted, shown as value / 10^decimals
+ * @param format                      output format
+ */
+NumFormatter::NumFormatter(signed value, const NumFormat& format) : fmt(format), suffix(format.suffix), state(STATE::PAD)
+{
+  uint8_t len;
+
+  rem = (value < 0) ? 0u - (uint32_t)value : (uint32_t)value;       // INT_MIN safe
+
+  if(value < 0)
+    sign_ch = '-';
+  else if(fmt.sign == SSD1306_NUM_SIGN::SPACE)
+    sign_ch = ' ';
+  else if(fmt.sign == SSD1306_NUM_SIGN::PLUS)
+    sign_ch = '+';
+  else
+    sign_ch = 0;
+
+  pos = 1;
+  while(pos < 10 && rem >= pow10_table[pos])
+    pos++;
+
+  if(pos < fmt.decimals + 1)                                        // at least one digit before the point: "0.05"
+    pos = fmt.decimals + 1;
+
+  point_pending = (fmt.decimals != 0);
+
+  len = pos + (sign_ch ? 1 : 0) + (point_pending ? 1 : 0);
+  pad_left = (fmt.width > len) ? fmt.width - len : 0;
+}
+
+
+
+
+/**
+ * @brief Returns next char of the formatted number
+ *
+ * @return                            char or 0 at the end of the number
+ */
+char NumFormatter::next()
+{
+  uint8_t digit;
+
+  switch(state)
+  {
+    case STATE::PAD:
+      if(pad_left && fmt.pad != '0')
+      {
+        pad_left--;
+        return fmt.pad;
+      }
+      state = STATE::SIGN;
+      // fall through
+
+    case STATE::SIGN:
+      state = STATE::ZEROS;
+      if(sign_ch)
+        return sign_ch;
+      // fall through
+
+    case STATE::ZEROS:
+      if(pad_left)
+      {
+        pad_left--;
+        return '0';
+      }
+      state = STATE::DIGITS;
+      // fall through
+
+    case STATE::DIGITS:
+      if(pos)
+      {
+        if(point_pending && pos == fmt.decimals)
+        {
+          point_pending = false;
+          return fmt.point;
+        }
+
+        pos--;
+        digit = rem / pow10_table[pos];
+        rem -= digit * pow10_table[pos];
+        return '0' + digit;
+      }
+      state = STATE::SUFFIX;
+      // fall through
+
+    case STATE::SUFFIX:
+      if(suffix && *suffix)
+        return *suffix++;
+      state = STATE::END;
+      // fall through
+
+    default:
+      return 0;
+  }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "stdint.h"
+
+
+enum class SSD1306_NUM_SIGN{                            // determines sign output of positive numbers (negative are always shown with minus)
+    MINUS,                                              // nothing before positive numbers - "12"
+    SPACE,                                              // space before positive numbers - " 12"
+    PLUS                                                // plus before positive numbers - "+12"
+};
+
+enum class SSD1306_NUM_ALIGN{                           // determines meaning of x coordinate of the number
+    LEFT,                                               // x is the first column of the number
+    RIGHT                                               // x is the last column of the number (suffix included)
+};
+
+
+
+/**
+ * @brief Number output format. The number is shown as value / 10^decimals, for example value = -1234, decimals = 2 gives "-12.34"
+ */
+struct NumFormat
+{
+    uint8_t decimals;                                   // digits after decimal point (0 .. 9)
+    const char* suffix;                                 // unit suffix, appended after the number ("V", "%"), may be null
+    uint8_t width;                                      // min width of the number in chars (sign and point included, suffix is not). Number is padded to it
+    char pad;                                           // padding char: '0' (after the sign) or ' ' (before the sign)
+    SSD1306_NUM_SIGN sign;
+    SSD1306_NUM_ALIGN align;
+    char point;                                         // decimal point char
+
+    explicit NumFormat(uint8_t num_decimals = 0, const char* num_suffix = (const char*)0, uint8_t num_width = 0, char num_pad = ' ',
+              SSD1306_NUM_SIGN num_sign = SSD1306_NUM_SIGN::MINUS, SSD1306_NUM_ALIGN num_align = SSD1306_NUM_ALIGN::LEFT, char num_point = '.') :
+    decimals(num_decimals > 9 ? 9 : num_decimals), suffix(num_suffix), width(num_width), pad(num_pad), sign(num_sign), align(num_align), point(num_point){}
+};
+
+
+
+/**
+ * @brief Produces chars of the formatted number one by one, without intermediate string.
+ *        Call "next" until it returns 0. Copy formatter to walk the same number twice (to measure and to draw it)
+ */
+class NumFormatter
+{
+    enum class STATE{PAD, SIGN, ZEROS, DIGITS, SUFFIX, END};
+
+    const NumFormat fmt;
+    const char* suffix;
+    uint32_t rem;                                       // digits which are not shown yet
+    uint8_t pos;                                        // amount of digits which are not shown yet
+    uint8_t pad_left;                                   // amount of padding chars which are not shown yet
+    char sign_ch;                                       // sign char or 0
+    bool point_pending;
+    STATE state;
+
+    public:
+    NumFormatter(signed value, const NumFormat& format);
+
+    char next();
+};
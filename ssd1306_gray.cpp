@@ -0,0 +1,377 @@
+#include "ssd1306_gray.hpp"
+#include "string.h"
+
+
+#define GRAY_TRANSFER_CMDS      6           // address range commands before every transfer (see "set_hv_range", "set_page_range")
+
+
+/**
+ * @brief Construct a new Gray Canvas. Planes are not cleared (call "clear" or "load"), the whole canvas is sent by the first frame
+ *
+ * @param segment                     not rotated display segment
+ * @param plane_lo                    low bit-plane, "plane_size(segment->sw, segment->sh)" size
+ * @param plane_hi                    high bit-plane, the same size
+ * @param frame_period_ms             (optional, def = 5) frame period of "run" in ms, cycle of 3 frames is 3 times longer
+ */
+GrayCanvas::GrayCanvas(DispSegment* segment, uint8_t* plane_lo, uint8_t* plane_hi, uint16_t frame_period_ms) :
+ds(segment), lo(plane_lo), hi(plane_hi), stale(0), phase(0), next(0), started(false), frames(0), late(0)
+{
+  if(ds->rotation != SSD1306_ROTATION::R0)
+    while(1);                                 // planes are copied to the segment memory by page bytes
+
+  memset(dxs, 0xFF, sizeof(dxs));
+  memset(dxe, 0, sizeof(dxe));
+  set_frame_period(frame_period_ms);
+  invalidate();
+}
+
+
+
+
+/**
+ * @brief Fills the canvas with the level
+ *
+ * @param level                       (optional, def = 0) gray level [0 .. 3]
+ */
+void GrayCanvas::clear(uint8_t level)
+{
+  uint16_t sz = plane_size(ds->sw, ds->sh);
+
+  memset(lo, (level & 0x01) ? 0xFF : 0x00, sz);
+  memset(hi, (level & 0x02) ? 0xFF : 0x00, sz);
+  invalidate();
+}
+
+
+
+
+/**
+ * @brief Sets the pixel level
+ *
+ * @param x_px                        x coordinate in px
+ * @param y_px                        y coordinate in px
+ * @param level                       gray level [0 .. 3]
+ */
+void GrayCanvas::draw_pixel(uint8_t x_px, uint8_t y_px, uint8_t level)
+{
+  if(x_px >= ds->sw || y_px >= ds->shp)
+    return;
+
+  uint16_t i = (y_px >> 3) * ds->sw + x_px;
+  uint8_t bit = 1 << (y_px & 0x07);
+
+  lo[i] = (level & 0x01) ? (lo[i] | bit) : (lo[i] & ~bit);
+  hi[i] = (level & 0x02) ? (hi[i] | bit) : (hi[i] & ~bit);
+
+  mark(y_px >> 3, x_px, x_px);
+}
+
+
+
+
+/**
+ * @brief Returns the pixel level (0 for pixels outside of the canvas)
+ */
+uint8_t GrayCanvas::get_pixel(uint8_t x_px, uint8_t y_px)
+{
+  if(x_px >= ds->sw || y_px >= ds->shp)
+    return 0;
+
+  uint16_t i = (y_px >> 3) * ds->sw + x_px;
+  uint8_t sh = y_px & 0x07;
+
+  return (((hi[i] >> sh) & 0x01) << 1) | ((lo[i] >> sh) & 0x01);
+}
+
+
+
+
+/**
+ * @brief Fills the area with the level (bars of gauges, gradient steps). The area is clipped by the canvas
+ *
+ * @param x_px                        x coordinate of the left upper corner in px
+ * @param y_px                        y coordinate of the left upper corner in px
+ * @param w_px                        width in px
+ * @param h_px                        height in px
+ * @param level                       gray level [0 .. 3]
+ */
+void GrayCanvas::fill_area(int16_t x_px, int16_t y_px, int16_t w_px, int16_t h_px, uint8_t level)
+{
+  int16_t xe = x_px + w_px - 1;
+  int16_t ye = y_px + h_px - 1;
+
+  if(x_px < 0) x_px = 0;
+  if(y_px < 0) y_px = 0;
+  if(xe >= ds->sw) xe = ds->sw - 1;
+  if(ye >= ds->shp) ye = ds->shp - 1;
+
+  if(w_px <= 0 || h_px <= 0 || x_px > xe || y_px > ye)
+    return;
+
+  for(uint8_t pg = y_px >> 3; pg <= (ye >> 3); pg++)
+  {
+    uint8_t mask = 0xFF;
+
+    if(pg == (y_px >> 3))
+      mask &= 0xFF << (y_px & 0x07);
+    if(pg == (ye >> 3))
+      mask &= 0xFF >> (7 - (ye & 0x07));
+
+    uint8_t lo_bits = (level & 0x01) ? mask : 0;
+    uint8_t hi_bits = (level & 0x02) ? mask : 0;
+    uint16_t i = pg * ds->sw + x_px;
+
+    for(int16_t x = x_px; x <= xe; x++, i++)
+    {
+      lo[i] = (lo[i] & ~mask) | lo_bits;
+      hi[i] = (hi[i] & ~mask) | hi_bits;
+    }
+
+    mark(pg, x_px, xe);
+  }
+}
+
+
+
+
+/**
+ * @brief Copies whole planes (splash screens prepared in page format, see "bitmap_rows_to_pages")
+ *
+ * @param lo_data                     low bit-plane data, "plane_size" bytes
+ * @param hi_data                     high bit-plane data, "plane_size" bytes
+ */
+void GrayCanvas::load(const uint8_t* lo_data, const uint8_t* hi_data)
+{
+  uint16_t sz = plane_size(ds->sw, ds->sh);
+
+  memcpy(lo, lo_data, sz);
+  memcpy(hi, hi_data, sz);
+  invalidate();
+}
+
+
+
+
+/**
+ * @brief Marks the whole canvas as drawn, it is sent by the next frame (use it after segment clear or direct plane changes)
+ */
+void GrayCanvas::invalidate()
+{
+  for(uint8_t pg = 0; pg < ds->sh; pg++)
+    mark(pg, 0, ds->sw - 1);
+}
+
+
+
+
+/**
+ * @brief Shows the next frame of the cycle. On plane change the gray runs and drawn columns are sent,
+ *        otherwise only drawn columns. Call it with fixed period or use "run"
+ */
+void GrayCanvas::show_frame()
+{
+  const uint8_t* plane = (phase == 2) ? lo : hi;
+  bool plane_changed = (phase != 1);          // frame 1 shows the same plane as frame 0
+  uint8_t xs, xe;
+
+  refresh_gray();
+
+  for(uint8_t pg = 0; pg < ds->sh; pg++)
+  {
+    xs = dxs[pg];
+    xe = dxe[pg];
+
+    if(plane_changed && gxs[pg] <= gxe[pg])
+    {
+      if(xs > xe)
+      {
+        xs = gxs[pg];
+        xe = gxe[pg];
+      }
+      else
+      {
+        if(gxs[pg] < xs) xs = gxs[pg];
+        if(gxe[pg] > xe) xe = gxe[pg];
+      }
+    }
+
+    if(xs <= xe)
+      send(pg, xs, xe, plane);
+
+    dxs[pg] = 0xFF;
+    dxe[pg] = 0;
+  }
+
+  phase = (phase == 2) ? 0 : phase + 1;
+  frames++;
+}
+
+
+
+
+/**
+ * @brief Frame scheduler: shows the frame if its time has come. Frames are kept on the fixed time grid
+ *        (next = previous + period), so the weights of the levels don't drift with call jitter. If the call is later
+ *        than the next frame, the missed frames are dropped (counted by "get_late_frames") and the grid is kept
+ *
+ * @param now_ms                      current time in ms (HAL_GetTick)
+ * @return true                       frame is shown
+ * @return false                      it's not time yet
+ */
+bool GrayCanvas::run(uint32_t now_ms)
+{
+  if(!started)
+  {
+    next = now_ms;
+    started = true;
+  }
+
+  if((int32_t)(now_ms - next) < 0)
+    return false;
+
+  show_frame();
+  next += period;
+
+  if((int32_t)(now_ms - next) >= 0)
+  {
+    uint32_t missed = (now_ms - next) / period + 1;
+
+    late += missed;
+    next += missed * period;
+  }
+
+  return true;
+}
+
+
+
+
+/**
+ * @brief Estimates the bus load of the steady state refresh (current gray runs, nothing is drawn).
+ *        All the traffic is sent by frames 0 and 2 of the cycle, half of the cycle bits by each, so the load
+ *        is counted for such a frame
+ *
+ * @param bus_clock_hz                bus clock (I2C: 100000 / 400000 / 1000000, SPI: up to 10000000)
+ * @param bus                         (optional, def = I2C) bus type
+ * @return                            transfers, bytes and bits per cycle, required throughput and share of the bus
+ */
+GrayBusLoad GrayCanvas::get_bus_load(uint32_t bus_clock_hz, SSD1306_BUS bus)
+{
+  GrayBusLoad load = {0, 0, 0, 0, 0, 0};
+  uint32_t cmd_bits, transfer_bits, data_bits;
+  uint8_t run_transfers;
+
+  refresh_gray();
+
+  // I2C: every command is sent as address + control + command bytes, data is sent after address + control bytes
+  if(bus == SSD1306_BUS::I2C)
+  {
+    cmd_bits = GRAY_TRANSFER_CMDS * 3 * 9;
+    transfer_bits = 2 * 9;
+    data_bits = 9;
+  }
+  else
+  {
+    cmd_bits = GRAY_TRANSFER_CMDS * 8;
+    transfer_bits = 0;
+    data_bits = 8;
+  }
+
+  for(uint8_t pg = 0; pg < ds->sh; pg++)
+    if(gxs[pg] <= gxe[pg])
+    {
+      // VERTICAL segment sends every column of the run by its own transfer (see "update_part")
+      run_transfers = (ds->addr_mode == SSD1306_ADDR_MODE::VERTICAL) ? gxe[pg] - gxs[pg] + 1 : 1;
+
+      load.transfers += 2 * run_transfers;
+      load.data_bytes += 2 * (gxe[pg] - gxs[pg] + 1);
+      load.bus_bits += 2 * (cmd_bits + run_transfers * transfer_bits);
+    }
+
+  load.bus_bits += load.data_bytes * data_bits;
+  load.bits_per_s = (uint64_t)load.bus_bits * 1000 / (3 * period);
+
+  if(bus_clock_hz)
+  {
+    uint64_t permille = (uint64_t)load.bus_bits * 1000000 / (2 * (uint64_t)period * bus_clock_hz);
+
+    load.load_permille = (permille > 0xFFFF) ? 0xFFFF : permille;
+    load.min_period_ms = ((uint64_t)load.bus_bits * 1000 + 2 * (uint64_t)bus_clock_hz - 1) / (2 * (uint64_t)bus_clock_hz);
+  }
+
+  return load;
+}
+
+
+
+
+/**
+ * @brief Extends the drawn columns of the page and marks its gray run to be found again
+ */
+void GrayCanvas::mark(uint8_t pg, uint8_t xs_px, uint8_t xe_px)
+{
+  if(dxs[pg] > dxe[pg])
+  {
+    dxs[pg] = xs_px;
+    dxe[pg] = xe_px;
+  }
+  else
+  {
+    if(xs_px < dxs[pg]) dxs[pg] = xs_px;
+    if(xe_px > dxe[pg]) dxe[pg] = xe_px;
+  }
+
+  stale |= 1 << pg;
+}
+
+
+
+
+/**
+ * @brief Finds the gray runs (first and last column where planes differ) of the stale pages
+ */
+void GrayCanvas::refresh_gray()
+{
+  for(uint8_t pg = 0; pg < ds->sh; pg++)
+  {
+    if(!(stale & (1 << pg)))
+      continue;
+
+    const uint8_t* l = lo + pg * ds->sw;
+    const uint8_t* h = hi + pg * ds->sw;
+
+    gxs[pg] = 0xFF;
+    gxe[pg] = 0;
+
+    for(uint8_t x = 0; x < ds->sw; x++)
+      if(l[x] != h[x])
+      {
+        if(gxs[pg] == 0xFF)
+          gxs[pg] = x;
+        gxe[pg] = x;
+      }
+  }
+
+  stale = 0;
+}
+
+
+
+
+/**
+ * @brief Copies the columns of the plane page to the segment memory and sends them to display
+ */
+void GrayCanvas::send(uint8_t pg, uint8_t xs_px, uint8_t xe_px, const uint8_t* plane)
+{
+  uint8_t* dst = ds->page_ptr(xs_px, pg);
+  const uint8_t* src = plane + pg * ds->sw + xs_px;
+  uint16_t step = ds->col_step();
+
+  if(step == 1)
+    memcpy(dst, src, xe_px - xs_px + 1);
+  else
+    for(uint8_t x = xs_px; x <= xe_px; x++, dst += step)
+      *dst = *src++;
+
+  ds->update_part(xs_px, pg*8, xe_px, pg*8 + 7);
+}
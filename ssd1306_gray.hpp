@@ -0,0 +1,78 @@
+#pragma once
+
+#include "ssd1306_display.hpp"
+
+
+enum class SSD1306_BUS{                     // bus of the display, used for bus load estimation
+    I2C,                                    // every byte takes 9 bits (ACK), every command is a separate transaction (address + control + command)
+    SPI                                     // every byte takes 8 bits, commands are single bytes
+};
+
+
+struct GrayBusLoad                          // bus load of grayscale refresh in steady state (nothing is drawn)
+{
+    uint16_t transfers;                     // data transfers per cycle (3 frames), VERTICAL segments send a transfer per column
+    uint16_t data_bytes;                    // GRAM bytes per cycle
+    uint32_t bus_bits;                      // bits on the bus per cycle, including commands and addressing
+    uint32_t bits_per_s;                    // average bus throughput at the set frame period (bit/s)
+    uint16_t load_permille;                 // share of the bus clock in the busiest frame (half of cycle bits per period),
+                                            // > 1000 - the cadence can't be kept
+    uint16_t min_period_ms;                 // shortest frame period the bus can keep
+};
+
+
+/**
+ * @brief 2-bit grayscale canvas: two bit-planes in page format, level = 2*hi + lo (0 - black, 3 - white).
+ *        Levels are shown by weighted frame alternation: a cycle is 3 frames, frames 0 and 1 show the hi plane, frame 2 shows
+ *        the lo plane, so a pixel is lit for "level" frames of 3. Only the column runs of every page where the planes differ
+ *        (gray runs) are copied to the segment memory and sent on plane changes (2 transfers per page per cycle),
+ *        drawn areas are sent by the next frame. "run" keeps the frame cadence on a fixed time grid.
+ *        Works on not rotated segments, the segment is redrawn by every frame regardless of its update mode
+ */
+class GrayCanvas
+{
+    DispSegment* ds;                        // pointer to display segment
+    uint8_t* lo;                            // low bit-plane, page format, "sw" bytes per page
+    uint8_t* hi;                            // high bit-plane
+
+    uint8_t gxs[8], gxe[8];                 // gray run of every page: first and last column (gxs > gxe - no run)
+    uint8_t dxs[8], dxe[8];                 // drawn (not sent yet) columns of every page
+    uint8_t stale;                          // pages whose gray runs have to be found again, bit per page
+
+    uint8_t phase;                          // frame of the cycle [0 .. 2]
+    uint16_t period;                        // frame period (ms)
+    uint32_t next;                          // time of the next frame (ms)
+    bool started;
+
+    uint32_t frames;                        // shown frames
+    uint32_t late;                          // frames dropped because "run" was called too late
+
+    void mark(uint8_t pg, uint8_t xs_px, uint8_t xe_px);
+    void refresh_gray();
+    void send(uint8_t pg, uint8_t xs_px, uint8_t xe_px, const uint8_t* plane);
+
+
+    public:
+
+    GrayCanvas(DispSegment* segment, uint8_t* plane_lo, uint8_t* plane_hi, uint16_t frame_period_ms = 5);
+
+    void clear(uint8_t level = 0);
+    void draw_pixel(uint8_t x_px, uint8_t y_px, uint8_t level);
+    uint8_t get_pixel(uint8_t x_px, uint8_t y_px);
+    void fill_area(int16_t x_px, int16_t y_px, int16_t w_px, int16_t h_px, uint8_t level);
+    void load(const uint8_t* lo_data, const uint8_t* hi_data);
+    void invalidate();
+
+    void show_frame();
+    bool run(uint32_t now_ms);
+
+    inline void set_frame_period(uint16_t frame_period_ms){period = frame_period_ms ? frame_period_ms : 1; started = false;}
+    inline uint16_t get_frame_period(){return period;}
+    inline uint32_t get_frames(){return frames;}
+    inline uint32_t get_late_frames(){return late;}
+
+    GrayBusLoad get_bus_load(uint32_t bus_clock_hz, SSD1306_BUS bus = SSD1306_BUS::I2C);
+
+    // size of one bit-plane (bytes)
+    static constexpr uint16_t plane_size(uint8_t w_px, uint8_t h_pg){return (uint16_t)w_px * h_pg;}
+};
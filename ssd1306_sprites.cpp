@@ -0,0 +1,454 @@
+#include "ssd1306_sprites.hpp"
+
+
+static inline bool rects_touch(const DispRect &a, const DispRect &b)
+{
+  return a.x <= b.x + b.w && b.x <= a.x + a.w && a.y <= b.y + b.h && b.y <= a.y + a.h;
+}
+
+
+static inline DispRect rects_bound(const DispRect &a, const DispRect &b)
+{
+  int16_t xs = (a.x < b.x) ? a.x : b.x;
+  int16_t ys = (a.y < b.y) ? a.y : b.y;
+  int16_t xe = (a.x + a.w > b.x + b.w) ? a.x + a.w : b.x + b.w;
+  int16_t ye = (a.y + a.h > b.y + b.h) ? a.y + a.h : b.y + b.h;
+
+  return DispRect{xs, ys, (int16_t)(xe - xs), (int16_t)(ye - ys)};
+}
+
+
+
+
+/**
+ * @brief Adds rectangle to the region. It is merged with the rectangles it touches. If the region already has two rectangles,
+ *        it is merged with the one which gives the smaller bounding box
+ *
+ * @param r                           rectangle (px), empty rectangles are ignored
+ */
+void DirtyRegion::add(const DispRect &r)
+{
+  DispRect m = r;
+  uint8_t i = 0;
+
+  if(r.w <= 0 || r.h <= 0)
+    return;
+
+  while(i < num)
+  {
+    if(rects_touch(rect[i], m))
+    {
+      m = rects_bound(rect[i], m);
+      rect[i] = rect[--num];
+      i = 0;                                  // bounding box may touch the rectangle checked before
+    }
+    else
+      i++;
+  }
+
+  if(num < 2)
+  {
+    rect[num++] = m;
+    return;
+  }
+
+  DispRect b0 = rects_bound(rect[0], m);
+  DispRect b1 = rects_bound(rect[1], m);
+
+  i = ((int32_t)b0.w*b0.h - (int32_t)rect[0].w*rect[0].h <= (int32_t)b1.w*b1.h - (int32_t)rect[1].w*rect[1].h) ? 0 : 1;
+  m = (i == 0) ? b0 : b1;
+  rect[i] = rect[--num];
+  add(m);
+}
+
+
+
+
+/**
+ * @brief Adds all rectangles of the other region
+ */
+void DirtyRegion::add(const DirtyRegion &region)
+{
+  for(uint8_t i = 0; i < region.num; i++)
+    add(region.rect[i]);
+}
+
+
+
+
+/**
+ * @brief Sends the region to display (one transfer per rectangle)
+ *
+ * @param segment                     display segment of the region
+ */
+void DirtyRegion::update(DispSegment* segment) const
+{
+  for(uint8_t i = 0; i < num; i++)
+    segment->update_clipped(rect[i].x, rect[i].y, rect[i].x + rect[i].w - 1, rect[i].y + rect[i].h - 1);
+}
+
+
+
+
+/**
+ * @brief Construct a new hidden Sprite at (0, 0)
+ *
+ * @param segment                     display segment to draw sprite
+ * @param image                       sprite image
+ * @param mask                        (optional, def = no mask) sprite mask, the same size as image
+ * @param save_under                  (optional, def = no buffer) save-under buffer, "save_under_size" of the largest image bytes
+ * @param save_under_sz               (optional, def = 0) save-under buffer size
+ */
+Sprite::Sprite(DispSegment* segment, const Bitmap &image, const Bitmap* mask, uint8_t* save_under, uint16_t save_under_sz) :
+ds(segment), img(&image), msk(mask), save(save_under), save_sz(save_under_sz), x(0), y(0), drawn{0, 0, 0, 0}, visible(false)
+{
+  if(save && save_under_size(image.w, image.h) > save_sz)
+    while(1);                                 // save-under buffer is too small
+}
+
+
+
+
+/**
+ * @brief Shows the sprite at its current position
+ *
+ * @return                            changed area
+ */
+DirtyRegion Sprite::show()
+{
+  if(visible)
+    return DirtyRegion();
+
+  visible = true;
+
+  return finish(draw());
+}
+
+
+
+
+/**
+ * @brief Shows the sprite at new position (moves it if it is shown already)
+ *
+ * @param x_px                        x coordinate of the left upper corner in px, may be outside of the segment
+ * @param y_px                        y coordinate of the left upper corner in px, may be outside of the segment
+ * @return                            changed area
+ */
+DirtyRegion Sprite::show(int16_t x_px, int16_t y_px)
+{
+  if(visible)
+    return move(x_px, y_px);
+
+  x = x_px;
+  y = y_px;
+
+  return show();
+}
+
+
+
+
+/**
+ * @brief Hides the sprite: restores the background under it
+ *
+ * @return                            changed area
+ */
+DirtyRegion Sprite::hide()
+{
+  if(!visible)
+    return DirtyRegion();
+
+  visible = false;
+
+  return finish(erase());
+}
+
+
+
+
+/**
+ * @brief Moves the sprite. Hidden sprite just takes the new position
+ *
+ * @param x_px                        x coordinate of the left upper corner in px, may be outside of the segment
+ * @param y_px                        y coordinate of the left upper corner in px, may be outside of the segment
+ * @return                            changed area: old and new sprite rectangles
+ */
+DirtyRegion Sprite::move(int16_t x_px, int16_t y_px)
+{
+  return finish(relocate(x_px, y_px));
+}
+
+
+
+
+/**
+ * @brief Changes the sprite image (animation frame). Shown sprite is redrawn
+ *
+ * @param image                       new image, its save-under size must fit the buffer
+ * @param mask                        (optional, def = no mask) mask of the new image
+ * @return                            changed area
+ */
+DirtyRegion Sprite::set_image(const Bitmap &image, const Bitmap* mask)
+{
+  return finish(replace_image(image, mask));
+}
+
+
+
+
+/**
+ * @brief Saves the background and draws the sprite at its position. Does not send anything to display
+ */
+DirtyRegion Sprite::draw()
+{
+  DirtyRegion region;
+  BlitSource bg(*ds);
+  uint8_t pages = (img->h + 7) / 8;
+
+  if(save)
+  {
+    for(uint8_t pg = 0; pg < pages; pg++)
+    {
+      int16_t row = y + pg*8;
+      uint8_t* dst = save + pg*img->w;
+
+      for(uint8_t col = 0; col < img->w; col++)
+        dst[col] = (x + col >= 0 && x + col < ds->sw && row > -8 && row < ds->shp) ? bg.get_page_byte(x + col, row) : 0;
+    }
+  }
+
+  if(msk)
+  {
+    ds->blit(BlitSource(*msk), x, y, SSD1306_ROP::ANDNOT);
+    ds->blit(BlitSource(*img), x, y, SSD1306_ROP::OR);
+  }
+  else
+    ds->blit(BlitSource(*img), x, y, SSD1306_ROP::OR);
+
+  drawn = DispRect{x, y, img->w, img->h};
+  region.add(clip(drawn));
+
+  return region;
+}
+
+
+
+
+/**
+ * @brief Removes the sprite drawn by "draw": restores the saved background or clears the sprite pixels
+ */
+DirtyRegion Sprite::erase()
+{
+  DirtyRegion region;
+
+  if(save)
+    ds->blit(BlitSource(save, drawn.w, drawn.h), drawn.x, drawn.y, SSD1306_ROP::COPY);
+  else
+    ds->blit(BlitSource(msk ? *msk : *img), drawn.x, drawn.y, SSD1306_ROP::ANDNOT);
+
+  region.add(clip(drawn));
+
+  return region;
+}
+
+
+
+
+/**
+ * @brief Moves the sprite without sending to display
+ */
+DirtyRegion Sprite::relocate(int16_t x_px, int16_t y_px)
+{
+  DirtyRegion region;
+  bool redraw = visible && (x_px != x || y_px != y);
+
+  if(redraw)
+    region = erase();
+
+  x = x_px;
+  y = y_px;
+
+  if(redraw)
+    region.add(draw());
+
+  return region;
+}
+
+
+
+
+/**
+ * @brief Changes the sprite image without sending to display
+ */
+DirtyRegion Sprite::replace_image(const Bitmap &image, const Bitmap* mask)
+{
+  DirtyRegion region;
+
+  if(save && save_under_size(image.w, image.h) > save_sz)
+    while(1);                                 // save-under buffer is too small
+
+  if(visible)
+    region = erase();
+
+  img = &image;
+  msk = mask;
+
+  if(visible)
+    region.add(draw());
+
+  return region;
+}
+
+
+
+
+/**
+ * @brief Clips rectangle by segment borders
+ */
+DispRect Sprite::clip(const DispRect &r)
+{
+  int16_t xs = (r.x < 0) ? 0 : r.x;
+  int16_t ys = (r.y < 0) ? 0 : r.y;
+  int16_t xe = (r.x + r.w > ds->sw) ? ds->sw : r.x + r.w;
+  int16_t ye = (r.y + r.h > ds->shp) ? ds->shp : r.y + r.h;
+
+  if(xe <= xs || ye <= ys)
+    return DispRect{0, 0, 0, 0};
+
+  return DispRect{xs, ys, (int16_t)(xe - xs), (int16_t)(ye - ys)};
+}
+
+
+
+
+/**
+ * @brief Sends the changed area to display in immediate mode
+ */
+DirtyRegion Sprite::finish(const DirtyRegion &region)
+{
+  if(ds->immediate_update_mode_enabled())
+    region.update(ds);
+
+  return region;
+}
+
+
+
+
+/**
+ * @brief Removes the visible sprites above the sprite, from the top one down
+ */
+void SpriteLayer::uncover(uint8_t index)
+{
+  for(uint8_t i = num - 1; i > index; i--)
+    if(sprites[i]->visible)
+      sprites[i]->erase();
+}
+
+
+
+
+/**
+ * @brief Draws the visible sprites above the sprite again, from the bottom one up. They save the new background
+ */
+void SpriteLayer::cover(uint8_t index)
+{
+  for(uint8_t i = index + 1; i < num; i++)
+    if(sprites[i]->visible)
+      sprites[i]->draw();
+}
+
+
+
+
+/**
+ * @brief Draws the sprites above the changed one and sends the changed area to display in immediate mode
+ */
+DirtyRegion SpriteLayer::finish(uint8_t index, const DirtyRegion &region)
+{
+  cover(index);
+
+  return sprites[index]->finish(region);
+}
+
+
+
+
+/**
+ * @brief Shows the sprite of the layer at its current position
+ *
+ * @param index                       sprite index
+ * @return                            changed area
+ */
+DirtyRegion SpriteLayer::show(uint8_t index)
+{
+  if(index >= num || sprites[index]->visible)
+    return DirtyRegion();
+
+  uncover(index);
+  sprites[index]->visible = true;
+
+  return finish(index, sprites[index]->draw());
+}
+
+
+
+
+/**
+ * @brief Hides the sprite of the layer
+ *
+ * @param index                       sprite index
+ * @return                            changed area
+ */
+DirtyRegion SpriteLayer::hide(uint8_t index)
+{
+  if(index >= num || !sprites[index]->visible)
+    return DirtyRegion();
+
+  uncover(index);
+  sprites[index]->visible = false;
+
+  return finish(index, sprites[index]->erase());
+}
+
+
+
+
+/**
+ * @brief Moves the sprite of the layer
+ *
+ * @param index                       sprite index
+ * @param x_px                        x coordinate of the left upper corner in px, may be outside of the segment
+ * @param y_px                        y coordinate of the left upper corner in px, may be outside of the segment
+ * @return                            changed area: old and new sprite rectangles
+ */
+DirtyRegion SpriteLayer::move(uint8_t index, int16_t x_px, int16_t y_px)
+{
+  if(index >= num)
+    return DirtyRegion();
+
+  uncover(index);
+
+  return finish(index, sprites[index]->relocate(x_px, y_px));
+}
+
+
+
+
+/**
+ * @brief Changes the image of the sprite of the layer
+ *
+ * @param index                       sprite index
+ * @param image                       new image
+ * @param mask                        (optional, def = no mask) mask of the new image
+ * @return                            changed area
+ */
+DirtyRegion SpriteLayer::set_image(uint8_t index, const Bitmap &image, const Bitmap* mask)
+{
+  if(index >= num)
+    return DirtyRegion();
+
+  uncover(index);
+
+  return finish(index, sprites[index]->replace_image(image, mask));
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "ssd1306_display.hpp"
+
+
+/**
+ * @brief Segment area changed by sprite operations: up to two rectangles which must be sent to display.
+ *        Touching rectangles are merged, so a short move is sent by one transfer and a long jump by two small ones
+ *        instead of their common bounding box
+ */
+struct DirtyRegion
+{
+    DispRect rect[2];
+    uint8_t num;
+
+    DirtyRegion() : num(0){}
+
+    void add(const DispRect &r);
+    void add(const DirtyRegion &region);
+    void update(DispSegment* segment) const;
+};
+
+
+
+
+/**
+ * @brief Bitmap which moves over static background (icons, cursors).
+ *        Set mask pixels belong to the sprite, zero mask pixels are transparent. Image pixels outside the mask must be zero.
+ *        Without mask set image pixels are drawn and zero image pixels are transparent.
+ *        With save-under buffer the background under the sprite is saved before drawing and restored when the sprite is moved
+ *        or hidden. Without it the sprite pixels are just cleared (use it for sprites over empty background).
+ *        Every operation returns the changed area. In immediate mode the sprite sends it to display by itself
+ */
+class Sprite
+{
+    friend class SpriteLayer;
+
+    DispSegment* ds;        // pointer to display segment
+    const Bitmap* img;      // sprite image
+    const Bitmap* msk;      // sprite mask (null - no mask)
+    uint8_t* save;          // save-under buffer (null - no buffer), page formatted
+    uint16_t save_sz;       // save-under buffer size (bytes)
+
+    int16_t x, y;           // sprite position (px)
+    DispRect drawn;         // where the sprite was drawn, to erase it after image change
+    bool visible;
+
+    DirtyRegion draw();
+    DirtyRegion erase();
+    DirtyRegion relocate(int16_t x_px, int16_t y_px);
+    DirtyRegion replace_image(const Bitmap &image, const Bitmap* mask);
+    DispRect clip(const DispRect &r);
+    DirtyRegion finish(const DirtyRegion &region);
+
+
+    public:
+
+    Sprite(DispSegment* segment, const Bitmap &image, const Bitmap* mask = (const Bitmap*)0, uint8_t* save_under = (uint8_t*)0, uint16_t save_under_sz = 0);
+
+    DirtyRegion show();
+    DirtyRegion show(int16_t x_px, int16_t y_px);
+    DirtyRegion hide();
+    DirtyRegion move(int16_t x_px, int16_t y_px);
+    DirtyRegion set_image(const Bitmap &image, const Bitmap* mask = (const Bitmap*)0);
+
+    inline bool is_visible(){return visible;}
+    inline int16_t get_x(){return x;}
+    inline int16_t get_y(){return y;}
+    inline DispRect get_rect(){return DispRect{x, y, img->w, img->h};}
+
+    // size of save-under buffer for the image (bytes)
+    static constexpr uint16_t save_under_size(uint8_t w_px, uint8_t h_px){return w_px * ((h_px + 7) / 8);}
+};
+
+
+
+
+/**
+ * @brief Overlapping sprites of one segment. Sprites are drawn in the array order: the last one is the top one.
+ *        To change a sprite the sprites above it are removed and drawn again, so every sprite restores its own background.
+ *        Only the area of the changed sprite is reported (and sent in immediate mode)
+ */
+class SpriteLayer
+{
+    Sprite* const* sprites;     // sprites from the bottom to the top
+    uint8_t num;                // amount of sprites
+
+    void uncover(uint8_t index);
+    void cover(uint8_t index);
+    DirtyRegion finish(uint8_t index, const DirtyRegion &region);
+
+
+    public:
+
+    SpriteLayer(Sprite* const* layer_sprites, uint8_t sprites_num) : sprites(layer_sprites), num(sprites_num){}
+
+    DirtyRegion show(uint8_t index);
+    DirtyRegion hide(uint8_t index);
+    DirtyRegion move(uint8_t index, int16_t x_px, int16_t y_px);
+    DirtyRegion set_image(uint8_t index, const Bitmap &image, const Bitmap* mask = (const Bitmap*)0);
+};
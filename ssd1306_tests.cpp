@@ -8,6 +8,7 @@
 #include <stdio.h>
 
 #include "ssd1306_tests.hpp"
+#include "ssd1306_font_tables.hpp"
 
 
 
@@ -29,6 +30,9 @@ void ssd1306_run_tests(SSD1306_Display* display)
     ssd1306_primitives_test(display);
     HAL_Delay(3000);
 
+    ssd1306_pattern_test(display);
+    HAL_Delay(3000);
+
     ssd1306_menu_test11(display);
     HAL_Delay(3000);
     ssd1306_menu_test12(display);
@@ -47,9 +51,30 @@ void ssd1306_run_tests(SSD1306_Display* display)
     ssd1306_layout_test(display);
     HAL_Delay(3000);
 
+    ssd1306_text_box_test(display);
+    HAL_Delay(3000);
+
     ssd1306_bitmap_test(display);
     HAL_Delay(3000);
 
+    ssd1306_bitmap_transform_test(display);
+    HAL_Delay(3000);
+
+    ssd1306_bitmap_bench(display);
+    HAL_Delay(3000);
+
+    ssd1306_numfield_test(display);
+    HAL_Delay(3000);
+
+    ssd1306_sprite_test(display);
+    HAL_Delay(3000);
+
+    ssd1306_tilemap_test(display);
+    HAL_Delay(3000);
+
+    ssd1306_gray_test(display);
+    HAL_Delay(3000);
+
     ssd1306_end_test(display);
 
     #else
@@ -108,6 +133,31 @@ void ssd1306_primitives_test(SSD1306_Display* display)
 
 
 
+/**
+ * @brief Pattern fills: dithered boxes, hatched circle and bar chart (pseudo-grayscale areas without extra draw passes)
+ */
+void ssd1306_pattern_test(SSD1306_Display* display)
+{
+    const FillPattern* patterns[] = {&PATTERN_BAYER12, &PATTERN_BAYER25, &PATTERN_BAYER50, &PATTERN_BAYER75, &PATTERN_CHECKER, &PATTERN_HLINES};
+    signed bars[4] = {25, 50, 75, 100};
+
+    display->clear_screen();
+    display->write_string(0, ROW1, "Pattern Test", font8);
+
+    for(uint8_t i = 0; i < 6; i++)
+        display->draw_box(i*12, ROW3, 10, 16, *patterns[i]);
+
+    display->draw_filled_circle(96, ROW4, 14, PATTERN_CROSSHATCH);
+    display->draw_rounded_box(0, ROW6, 70, 16, 4, PATTERN_HATCH);
+
+    BarChart::draw(display->dds, bars, 80, display->HEIGHT_PX - 1, 4, 8, 4, 16, 0, 100, PATTERN_BAYER50);
+
+    display->update_screen();
+}
+
+
+
+
 /**
  * @brief Menu, drawed with font8 test
  */
@@ -153,8 +203,13 @@ void ssd1306_menu_test12(SSD1306_Display* display)
 
 
 
+// Checkbox titles rasterized at compile time: drawn by one blit each
+SSD1306_STATIC_LABEL(lbl_disabled, font8_tables, "Disabled");
+SSD1306_STATIC_LABEL(lbl_enabled, font8_tables, "Enabled");
+
+
 /**
- * @brief Menu (checkbox & bar), drawed with font8 test
+ * @brief Menu (checkbox & bar), drawed with font8 test. Titles are static labels
  */
 void ssd1306_menu_test21(SSD1306_Display* display)
 {
@@ -163,8 +218,8 @@ void ssd1306_menu_test21(SSD1306_Display* display)
     display->write_string(0, ROW1, "Menu Test #2.1", font16);
 
     display->set_select_method(SSD1306_ITEM_SELECT_METHOD::ARROW);
-    display->draw_checkbox(ROW3, "Disabled", font8, false);
-    display->draw_checkbox(ROW4, "Enabled", font8, true, true);
+    display->draw_checkbox(ROW3, lbl_disabled, font8, false);
+    display->draw_checkbox(ROW4, lbl_enabled, font8, true, true);
 
     display->draw_hbar(ROW6, 50, font8);
     display->draw_hbar(ROW7, 70, font8);
@@ -327,6 +382,34 @@ void ssd1306_layout_test(SSD1306_Display* display)
 
 
 
+/**
+ * @brief Text boxes: word wrap with alignment, ellipsis, and the space which does not fit the box being the row break
+ */
+void ssd1306_text_box_test(SSD1306_Display* display)
+{
+    DispRect box = {0, ROW3, 60, 40};
+    DispRect drawn;
+
+    display->clear_screen();
+
+    display->write_string(0, ROW1, "Text box Test", font16);
+
+    display->write_text_box(box, "Long text is wrapped by words and centered", font8, SSD1306_TEXT_ALIGN::CENTER);
+
+    // the box is exactly as wide as "aaaa": the space after it is the break, "bbbb" is the second row, no blank row between
+    box = {68, ROW3, (int16_t)font8.get_string_width("aaaa"), 40};
+    drawn = display->write_text_box(box, "aaaa bbbb", font8);
+    display->draw_frame(drawn.x + drawn.w + 2, drawn.y, 3, drawn.h);       // bar of the drawn height: 2 rows
+
+    box = {68, ROW6, 60, 8};
+    display->write_text_box(box, "Text that does not fit", font8, SSD1306_TEXT_ALIGN::LEFT, TEXT_ELLIPSIS);
+
+    display->update_screen();
+}
+
+
+
+
 /**
  * @brief Picture test
  */
@@ -344,6 +427,209 @@ void ssd1306_bitmap_test(SSD1306_Display* display)
 
 
 
+/**
+ * @brief Mirrored and scaled bitmaps: one "small_car" image in several directions and sizes
+ */
+void ssd1306_bitmap_transform_test(SSD1306_Display* display)
+{
+    display->clear_screen();
+
+    display->draw_bitmap_flipped(0, ROW1, small_car, FLIP_NONE);
+    display->draw_bitmap_flipped(64, ROW1, small_car, FLIP_H);
+    display->draw_bitmap_flipped(0, ROW4, small_car, FLIP_V);
+
+    display->draw_bitmap_scaled(64, ROW4, small_car, 30, 10);
+    display->draw_bitmap_scaled(96, ROW4, small_car, 30, 10, FLIP_H);
+    display->draw_bitmap_scaled(64, ROW6, small_car, 45, 15, FLIP_H | FLIP_V);
+
+    display->update_screen();
+}
+
+
+
+
+/**
+ * @brief Row-major bitmap drawing benchmark: per pixel drawing vs "draw_bitmap" (8x8 bit transpose).
+ *        Loops are long enough for 1 ms tick resolution, average time of one draw is shown in us.
+ *        Host version with high resolution clock: tools/ssd1306_bench.cpp
+ */
+void ssd1306_bitmap_bench(SSD1306_Display* display)
+{
+    static uint8_t car_rows[(128 / 8) * 42];
+    const unsigned loops = 500;
+    uint32_t start, t_pixel, t_transpose;
+
+    // row-major copy of "big_car", which is stored page-major
+    for(unsigned y = 0; y < big_car.h; y++)
+        for(unsigned x = 0; x < big_car.w; x++)
+            if((big_car.data[(y / 8) * big_car.w + x] >> (y % 8)) & 0x01)
+                car_rows[y * (big_car.w / 8) + x / 8] |= 0x80 >> (x % 8);
+
+    Bitmap car(big_car.w, big_car.h, car_rows);
+
+    display->clear_screen();
+
+    start = HAL_GetTick();
+    for(unsigned n = 0; n < loops; n++)
+        for(uint8_t y = 0; y < car.h; y++)
+            for(uint8_t x = 0; x < car.w; x++)
+                display->draw_pixel(x, ROW3 + y, (car.data[y * (car.w / 8) + x / 8] >> (7 - x % 8)) & 0x01);
+    t_pixel = HAL_GetTick() - start;
+
+    start = HAL_GetTick();
+    for(unsigned n = 0; n < loops; n++)
+        display->draw_bitmap(0, ROW3, car);
+    t_transpose = HAL_GetTick() - start;
+
+    display->clear_screen();
+    display->write_string(0, ROW1, "Bitmap Bench", font16);
+    display->draw_param(ROW4, "Per pixel, us", font8, t_pixel * 1000 / loops);
+    display->draw_param(ROW5, "Transpose, us", font8, t_transpose * 1000 / loops);
+    display->update_screen();
+}
+
+
+
+
+/**
+ * @brief Numeric field test: odometer-like counters, only changed digits are redrawn
+ */
+void ssd1306_numfield_test(SSD1306_Display* display)
+{
+    char counter_chars[3];
+    char voltage_chars[5];
+
+    display->clear_screen();
+    display->set_segment_update_mode_immediately();
+
+    NumField counter(display->dds, counter_chars, 0, ROW1, 3, font_dig32);
+    NumField voltage(display->dds, voltage_chars, 64, ROW6, 5, font16, NumFormat(2, "V"));
+
+    for(signed i = 0; i < 1000; i++)
+    {
+        counter.show(i);
+        voltage.show(330 - i / 4);
+    }
+
+    // Negative fixed-point value in digits only font: minus and point are drawn as bars
+    char temp_chars[5];
+
+    display->clear_screen();
+    NumField temp(display->dds, temp_chars, 0, ROW2, 5, font_dig32, NumFormat(2));
+
+    for(signed t = -250; t <= 250; t += 5)
+    {
+        temp.show(t);
+        HAL_Delay(20);
+    }
+
+    display->set_segment_update_mode_on_demand();
+}
+
+
+
+
+/**
+ * @brief Sprite test: car drives over the text, battery icon charges. Only old and new sprite areas are sent
+ */
+void ssd1306_sprite_test(SSD1306_Display* display)
+{
+    static uint8_t car_under[Sprite::save_under_size(60, 20)];
+    static uint8_t accum_under[Sprite::save_under_size(13, 8)];
+
+    display->clear_screen();
+    display->write_string(0, ROW1, "Sprite Test", font16);
+    display->write_string(0, ROW5, "Background is saved and restored", font5);
+    display->draw_hline(0, ROW8 + 7, display->WIDTH_PX);
+    display->update_screen();
+    display->set_segment_update_mode_immediately();
+
+    Sprite car(display->dds, small_car, (const Bitmap*)0, car_under, sizeof(car_under));
+    Sprite battery(display->dds, accum[0], (const Bitmap*)0, accum_under, sizeof(accum_under));
+
+    battery.show(display->WIDTH_PX - 20, ROW1);
+
+    for(int16_t x = -60; x <= display->WIDTH_PX; x += 2)
+    {
+        car.show(x, ROW5);
+        battery.set_image(accum[((x + 60) / 40) % 5]);
+        HAL_Delay(20);
+    }
+
+    car.hide();
+    display->set_segment_update_mode_on_demand();
+}
+
+
+
+
+/**
+ * @brief Tile map test: grid of battery icons (tiles of "accum" bitmaps), only changed icons are sent
+ */
+void ssd1306_tilemap_test(SSD1306_Display* display)
+{
+    const uint8_t cols = 9, rows = 6;
+    uint8_t map[cols * rows];
+    uint8_t dirty[TileMap::dirty_size(cols, rows)];
+
+    Tileset batteries(accum[0].data, accum[0].w, 1, 5);             // "accum" images follow one after another
+
+    display->clear_screen();
+    display->write_string(0, ROW1, "Tile Map Test", font8);
+    display->set_segment_update_mode_immediately();
+
+    TileMap grid(display->dds, batteries, map, dirty, 4, PROW3, cols, rows);
+    grid.fill(0);
+    grid.draw();
+
+    for(uint16_t i = 0; i < 500; i++)
+    {
+        grid.set_tile(i % cols, (i * 7) % rows, (i / 3) % 5);
+        grid.draw();
+        HAL_Delay(10);
+    }
+
+    display->set_segment_update_mode_on_demand();
+}
+
+
+
+
+/**
+ * @brief Grayscale test: 4 level bands (splash) and gauge bar of 3 levels, shown by frame alternation for 5 s
+ */
+void ssd1306_gray_test(SSD1306_Display* display)
+{
+    static uint8_t lo[GrayCanvas::plane_size(128, 8)];
+    static uint8_t hi[GrayCanvas::plane_size(128, 8)];
+
+    DispSegment* seg = display->dds;
+    GrayCanvas gray(seg, lo, hi, 4);
+
+    gray.clear(0);
+
+    for(uint8_t level = 0; level < 4; level++)
+        gray.fill_area(level * seg->sw/4, 0, seg->sw/4, 16, level);
+
+    uint32_t start = HAL_GetTick();
+    uint32_t now = start;
+
+    while(now - start < 5000)
+    {
+        uint8_t gauge = ((now - start) / 20) % seg->sw;
+
+        gray.fill_area(0, seg->shp - 12, gauge, 12, 3);                     // value
+        gray.fill_area(gauge, seg->shp - 12, 2, 12, 2);                     // pointer
+        gray.fill_area(gauge + 2, seg->shp - 12, seg->sw, 12, 1);           // rest of the scale
+
+        gray.run(now);
+        now = HAL_GetTick();
+    }
+}
+
+
+
+
 /**
  * @brief Some ssd1306 hardware features test
  */
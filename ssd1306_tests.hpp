@@ -7,6 +7,7 @@ void ssd1306_run_tests(SSD1306_Display* display);
 
 void ssd1306_font_test(SSD1306_Display* display);
 void ssd1306_primitives_test(SSD1306_Display* display);
+void ssd1306_pattern_test(SSD1306_Display* display);
 void ssd1306_menu_test11(SSD1306_Display* display);
 void ssd1306_menu_test12(SSD1306_Display* display);
 void ssd1306_menu_test21(SSD1306_Display* display);
@@ -14,7 +15,14 @@ void ssd1306_menu_test22(SSD1306_Display* display);
 void ssd1306_chart_test(SSD1306_Display* display);
 void ssd1306_plot_test(SSD1306_Display* display);
 void ssd1306_layout_test(SSD1306_Display* display);
+void ssd1306_text_box_test(SSD1306_Display* display);
 void ssd1306_bitmap_test(SSD1306_Display* display);
+void ssd1306_bitmap_transform_test(SSD1306_Display* display);
+void ssd1306_bitmap_bench(SSD1306_Display* display);
+void ssd1306_numfield_test(SSD1306_Display* display);
+void ssd1306_sprite_test(SSD1306_Display* display);
+void ssd1306_tilemap_test(SSD1306_Display* display);
+void ssd1306_gray_test(SSD1306_Display* display);
 void ssd1306_end_test(SSD1306_Display* display);
 
 void my_test(SSD1306_Display* display);
\ No newline at end of file
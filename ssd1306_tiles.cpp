@@ -0,0 +1,202 @@
+#include "ssd1306_tiles.hpp"
+#include "string.h"
+
+
+/**
+ * @brief Construct a new Tile Map. All cells are marked as changed, so the first "draw" draws the whole map
+ *
+ * @param segment                     display segment to draw map
+ * @param tileset                     tiles
+ * @param tile_map                    tile index of every cell, "cols_num * rows_num" size, row by row. Indexes outside the tileset are drawn empty
+ * @param dirty_bits                  changed cells bitset, "dirty_size(cols_num, rows_num)" size
+ * @param x_px                        x coordinate of the map in px
+ * @param page                        page of the map (y coordinate in pages)
+ * @param cols_num                    amount of map columns
+ * @param rows_num                    amount of map rows
+ */
+TileMap::TileMap(DispSegment* segment, const Tileset& tileset, uint8_t* tile_map, uint8_t* dirty_bits, uint8_t x_px, uint8_t page, uint8_t cols_num, uint8_t rows_num) :
+ds(segment), ts(tileset), map(tile_map), dirty(dirty_bits), x(x_px), pg(page), cols(cols_num), rows(rows_num)
+{
+  if(x + (unsigned)cols*ts.w > ds->sw || (pg + (unsigned)rows*ts.pages)*8 > ds->shp)
+    while(1);                                 // map is outside of the segment
+
+  invalidate();
+}
+
+
+
+
+/**
+ * @brief Sets tile of the cell. The cell is marked as changed only if the tile differs
+ *
+ * @param col                         cell column
+ * @param row                         cell row
+ * @param tile                        tile index
+ */
+void TileMap::set_tile(uint8_t col, uint8_t row, uint8_t tile)
+{
+  if(col >= cols || row >= rows)
+    return;
+
+  uint16_t c = cell(col, row);
+
+  if(map[c] != tile)
+  {
+    map[c] = tile;
+    mark(c);
+  }
+}
+
+
+
+
+/**
+ * @brief Returns tile of the cell (0 for cells outside of the map)
+ */
+uint8_t TileMap::get_tile(uint8_t col, uint8_t row)
+{
+  return (col < cols && row < rows) ? map[cell(col, row)] : 0;
+}
+
+
+
+
+/**
+ * @brief Sets the tile to all cells
+ */
+void TileMap::fill(uint8_t tile)
+{
+  for(uint8_t row = 0; row < rows; row++)
+    for(uint8_t col = 0; col < cols; col++)
+      set_tile(col, row, tile);
+}
+
+
+
+
+/**
+ * @brief Puts chars of the string to the row cells: tile = char code - "first_code" of the tileset.
+ *        Chars which have no tile are put as tile 0. The string is cut at the end of the row
+ *
+ * @param col                         first cell column
+ * @param row                         cell row
+ * @param str                         string
+ * @return                            amount of cells written
+ */
+uint8_t TileMap::write_string(uint8_t col, uint8_t row, const char* str)
+{
+  uint8_t n = 0;
+  uint8_t tile;
+
+  for(; *str && col + n < cols; str++, n++)
+  {
+    tile = (uint8_t)*str - ts.first_code;
+    set_tile(col + n, row, (tile < ts.num) ? tile : 0);
+  }
+
+  return n;
+}
+
+
+
+
+/**
+ * @brief Marks all cells as changed (use it after segment clear)
+ */
+void TileMap::invalidate()
+{
+  memset(dirty, 0xFF, dirty_size(cols, rows));
+}
+
+
+
+
+/**
+ * @brief Draws the changed cells and clears their marks. In immediate mode the changed cells are sent to display:
+ *        neighbouring changed cells of a row by one transfer, the whole map by one transfer if all cells are changed
+ */
+void TileMap::draw()
+{
+  uint16_t cells = (uint16_t)cols * rows;
+  uint16_t changed = 0;
+  uint8_t run_start;
+
+  for(uint16_t c = 0; c < cells; c++)
+    if(is_dirty(c))
+      changed++;
+
+  if(changed == 0)
+    return;
+
+  bool send_runs = ds->immediate_update_mode_enabled() && changed < cells;
+
+  for(uint8_t row = 0; row < rows; row++)
+  {
+    run_start = cols;
+
+    for(uint8_t col = 0; col < cols; col++)
+    {
+      if(is_dirty(cell(col, row)))
+      {
+        draw_tile(col, row);
+
+        if(run_start == cols)
+          run_start = col;
+      }
+      else if(run_start != cols)
+      {
+        if(send_runs)
+          update_cells(row, run_start, col - 1);
+        run_start = cols;
+      }
+    }
+
+    if(run_start != cols && send_runs)
+      update_cells(row, run_start, cols - 1);
+  }
+
+  memset(dirty, 0, dirty_size(cols, rows));
+
+  if(ds->immediate_update_mode_enabled() && changed == cells)
+    ds->update_part(x, pg*8, x + cols*ts.w - 1, (pg + rows*ts.pages)*8 - 1);
+}
+
+
+
+
+/**
+ * @brief Copies the cell tile to the segment memory by whole page bytes
+ */
+void TileMap::draw_tile(uint8_t col, uint8_t row)
+{
+  uint8_t tile = map[cell(col, row)];
+  const uint8_t* src = ts.get_tile(tile);
+  uint16_t step = ds->col_step();
+
+  for(uint8_t p = 0; p < ts.pages; p++, src += ts.w)
+  {
+    uint8_t* dst = ds->page_ptr(x + col*ts.w, pg + row*ts.pages + p);
+
+    if(tile >= ts.num)
+      for(uint8_t i = 0; i < ts.w; i++, dst += step)
+        *dst = 0;
+    else if(step == 1)
+      memcpy(dst, src, ts.w);
+    else
+      for(uint8_t i = 0; i < ts.w; i++, dst += step)
+        *dst = src[i];
+  }
+}
+
+
+
+
+/**
+ * @brief Sends the run of row cells to display
+ */
+void TileMap::update_cells(uint8_t row, uint8_t first_col, uint8_t last_col)
+{
+  uint8_t ys = (pg + row*ts.pages)*8;
+
+  ds->update_part(x + first_col*ts.w, ys, x + (last_col + 1)*ts.w - 1, ys + ts.pages*8 - 1);
+}
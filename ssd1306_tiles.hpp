@@ -0,0 +1,70 @@
+#pragma once
+
+#include "ssd1306_display.hpp"
+
+
+/**
+ * @brief Set of equal tiles in page format. Every tile is "pages" pages of "w" bytes, pages follow one after another,
+ *        tiles follow one after another (page-major bitmap of W x 8*pages px per tile).
+ *        "first_code" is the char code of tile 0, it is used to print strings by tiles (character-mode UI)
+ */
+class Tileset
+{
+    public:
+    const uint8_t* const data;
+    const uint8_t w;                // tile width (px)
+    const uint8_t pages;            // tile height (pages)
+    const uint8_t num;              // amount of tiles
+    const uint8_t first_code;       // char code of tile 0
+
+    Tileset(const uint8_t* tiles_data, uint8_t tile_w_px, uint8_t tile_h_pg, uint8_t tiles_num, uint8_t first_char_code = 0) :
+        data(tiles_data), w(tile_w_px), pages(tile_h_pg), num(tiles_num), first_code(first_char_code){}
+
+    inline const uint8_t* get_tile(uint8_t tile) const {return data + (uint16_t)tile * w * pages;}
+};
+
+
+
+
+/**
+ * @brief Page-aligned grid of tiles (character-mode screens, status icon rows, simple games).
+ *        The map stores one tile index per cell. Changed cells are marked in the dirty bitset, "draw" copies only them
+ *        to the segment memory by whole page bytes (memcpy) and in immediate mode sends runs of neighbouring changed cells
+ *        of each row by one transfer
+ */
+class TileMap
+{
+    DispSegment* ds;            // pointer to display segment
+    const Tileset& ts;          // tiles
+    uint8_t* map;               // tile index of every cell, row by row
+    uint8_t* dirty;             // changed cells bitset, bit per cell
+
+    uint8_t x;                  // x coordinate of the left upper corner (px)
+    uint8_t pg;                 // page of the left upper corner
+    uint8_t cols, rows;         // map size (cells)
+
+    inline uint16_t cell(uint8_t col, uint8_t row) const {return (uint16_t)row * cols + col;}
+    inline bool is_dirty(uint16_t c) const {return dirty[c >> 3] & (1 << (c & 0x07));}
+    inline void mark(uint16_t c) {dirty[c >> 3] |= 1 << (c & 0x07);}
+
+    void draw_tile(uint8_t col, uint8_t row);
+    void update_cells(uint8_t row, uint8_t first_col, uint8_t last_col);
+
+
+    public:
+
+    TileMap(DispSegment* segment, const Tileset& tileset, uint8_t* tile_map, uint8_t* dirty_bits, uint8_t x_px, uint8_t page, uint8_t cols_num, uint8_t rows_num);
+
+    void set_tile(uint8_t col, uint8_t row, uint8_t tile);
+    uint8_t get_tile(uint8_t col, uint8_t row);
+    void fill(uint8_t tile);
+    uint8_t write_string(uint8_t col, uint8_t row, const char* str);
+    void invalidate();
+    void draw();
+
+    inline uint8_t get_cols(){return cols;}
+    inline uint8_t get_rows(){return rows;}
+
+    // size of dirty bitset (bytes)
+    static constexpr uint16_t dirty_size(uint8_t cols_num, uint8_t rows_num){return ((uint16_t)cols_num * rows_num + 7) / 8;}
+};
@@ -0,0 +1,175 @@
+#include "ssd1306_widgets.hpp"
+
+
+#define NUMFIELD_NO_RUN 0xFF
+
+
+/**
+ * @brief Construct a new empty Num Field
+ */
+NumField::NumField() : ds((DispSegment*)0), fnt((Font*)0), lc((char*)0), x(0), y(0), cnum(0), cw(0), color(true){}
+
+
+
+
+/**
+ * @brief Construct a new Num Field with default number format
+ *
+ * @param segment                     display segment to display field
+ * @param last_chars                  pointer to array for storing last shown chars, "cells_num" size
+ * @param x_px                        x coordinate of the field in px
+ * @param y_px                        y coordinate of the field in px
+ * @param cells_num                   field width in chars
+ * @param font                        field font
+ * @param color_noinv                 (optional, def = true) determines color no inversion
+ */
+NumField::NumField(DispSegment* segment, char* last_chars, uint8_t x_px, uint8_t y_px, uint8_t cells_num, Font &font, bool color_noinv) :
+NumField(segment, last_chars, x_px, y_px, cells_num, font, NumFormat(), color_noinv){}
+
+
+
+
+/**
+ * @brief Construct a new Num Field
+ *
+ * @param segment                     display segment to display field
+ * @param last_chars                  pointer to array for storing last shown chars, "cells_num" size
+ * @param x_px                        x coordinate of the field in px
+ * @param y_px                        y coordinate of the field in px
+ * @param cells_num                   field width in chars (sign, point and suffix included)
+ * @param font                        field font. With "font_dig32" minus and point are drawn as bars, other non-digit chars are skipped
+ * @param format                      number format
+ * @param color_noinv                 (optional, def = true) determines color no inversion
+ */
+NumField::NumField(DispSegment* segment, char* last_chars, uint8_t x_px, uint8_t y_px, uint8_t cells_num, Font &font, const NumFormat &format, bool color_noinv) :
+ds(segment), fnt(&font), lc(last_chars), fmt(format), x(x_px), y(y_px), cnum(cells_num), cw(font.width + font.interval), color(color_noinv)
+{
+  invalidate();
+}
+
+
+
+
+/**
+ * @brief Forgets the last shown chars. The whole field is redrawn by the next "show" call (use it after screen clear)
+ */
+void NumField::invalidate()
+{
+  for(uint8_t i = 0; i < cnum; i++)
+    lc[i] = 0;
+}
+
+
+
+
+/**
+ * @brief Displays the number. Only changed cells are redrawn. In immediate mode the changed cells are sent to display,
+ *        neighbouring changed cells are sent by one transfer
+ *
+ * @param num                         number to display
+ */
+void NumField::show(signed num)
+{
+  NumFormatter nf(num, fmt);
+  NumFormatter counter = nf;
+  uint8_t len = 0;
+  uint8_t run_start = NUMFIELD_NO_RUN;      // first cell of changed cells run
+  char ch;
+
+  while(counter.next())
+    len++;
+
+  for(; len > cnum; len--)                  // Number is longer than field: skip its first chars
+    nf.next();
+
+  for(uint8_t i = 0; i < cnum; i++)
+  {
+    ch = (i < cnum - len) ? ' ' : nf.next();
+
+    if(ch != lc[i])
+    {
+      draw_cell(i, ch);
+      lc[i] = ch;
+
+      if(run_start == NUMFIELD_NO_RUN)
+        run_start = i;
+    }
+    else if(run_start != NUMFIELD_NO_RUN)
+    {
+      update_cells(run_start, i - 1);
+      run_start = NUMFIELD_NO_RUN;
+    }
+  }
+
+  if(run_start != NUMFIELD_NO_RUN)
+    update_cells(run_start, cnum - 1);
+}
+
+
+
+
+/**
+ * @brief Clears the cell and draws the char in it. The char is centered in the cell.
+ *        Minus and point which the font has no glyphs for (digits only fonts) are drawn as bars, other such chars are skipped
+ *
+ * @param cell                        cell index
+ * @param ch                          char to draw (space - empty cell)
+ */
+void NumField::draw_cell(uint8_t cell, char ch)
+{
+  uint8_t cx = x + cell*cw;
+  uint8_t w = (cell == cnum - 1) ? fnt->width : cw;       // intercharacter spacing is cleared too, except the last cell
+  uint8_t sw;
+
+  ds->fill_area(cx, y, w, fnt->height, !color);
+
+  if(ch == ' ')
+    return;
+
+  if(!fnt->has_glyph(ch))
+  {
+    draw_mark(cx, ch);
+    return;
+  }
+
+  sw = fnt->get_symbol_width(ch);
+
+  if(ds->set_cursor(cx + ((fnt->width - sw) >> 1), y))
+    ds->write_char(ch, *fnt, color, true);
+}
+
+
+
+
+/**
+ * @brief Draws minus or point in the cell by a bar (for fonts which have no such glyphs)
+ *
+ * @param cx                          x coordinate of the cell in px
+ * @param ch                          '-' or '.', other chars are not drawn
+ */
+void NumField::draw_mark(uint8_t cx, char ch)
+{
+  uint8_t t = (fnt->height >= 16) ? fnt->height / 8 : 2;  // bar thickness
+
+  if(ch == '-')
+    ds->fill_area(cx + fnt->width/6, y + (fnt->height - t)/2, fnt->width - 2*(fnt->width/6), t, color);
+  else if(ch == '.')
+    ds->fill_area(cx + (fnt->width - t)/2, y + fnt->height - t, t, t, color);
+}
+
+
+
+
+/**
+ * @brief Sends the cells run to display. Works only in immediate mode
+ *
+ * @param first_cell                  first cell of the run
+ * @param last_cell                   last cell of the run
+ */
+void NumField::update_cells(uint8_t first_cell, uint8_t last_cell)
+{
+  uint8_t xe = x + last_cell*cw + ((last_cell == cnum - 1) ? fnt->width : cw) - 1;
+
+  if(ds->immediate_update_mode_enabled())
+    ds->update_clipped(x + first_cell*cw, y, xe, y + fnt->height - 1);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "ssd1306_display.hpp"
+
+
+/**
+ * @brief Numeric field with fixed position, width and font (odometer-like).
+ *        The field is divided into cells of equal width - one cell per char. It remembers the last shown chars
+ *        and redraws (and sends to display) only the cells which have changed.
+ *        The number is right aligned in the field. If it is longer than the field, only its last chars are shown
+ */
+class NumField
+{
+    DispSegment* ds;        // pointer to display segment
+    Font* fnt;              // field font
+    char* lc;               // last shown chars, one per cell
+
+    NumFormat fmt;          // number format
+
+    uint8_t x, y;           // field coordinates (px)
+    uint8_t cnum;           // cells num
+    uint8_t cw;             // cell width with intercharacter spacing (px)
+    bool color;             // color no inversion
+
+    void draw_cell(uint8_t cell, char ch);
+    void draw_mark(uint8_t cx, char ch);
+    void update_cells(uint8_t first_cell, uint8_t last_cell);
+
+
+    public:
+
+    NumField();
+    NumField(DispSegment* segment, char* last_chars, uint8_t x_px, uint8_t y_px, uint8_t cells_num, Font &font, bool color_noinv = true);
+    NumField(DispSegment* segment, char* last_chars, uint8_t x_px, uint8_t y_px, uint8_t cells_num, Font &font, const NumFormat &format, bool color_noinv = true);
+
+    void show(signed num);
+    void invalidate();
+
+    inline uint8_t get_width_px(){return cnum ? cnum*cw - fnt->interval : 0;}
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+/*
+ * Host stand-in for the STM32 HAL: lets the library be built by the host compiler for benchmarks (see ssd1306_bench.cpp).
+ * Transfers to the display are discarded
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct { uint32_t CR; } DMA_Stream_TypeDef;
+typedef struct { DMA_Stream_TypeDef* Instance; } DMA_HandleTypeDef;
+typedef struct { int State; DMA_HandleTypeDef* hdmatx; } I2C_HandleTypeDef;
+
+#define HAL_I2C_STATE_READY     0
+#define I2C_MEMADD_SIZE_8BIT    1
+#define HAL_MAX_DELAY           0xFFFFFFFF
+#define DMA_SxCR_MINC           0x400
+
+static inline int HAL_I2C_Mem_Write(I2C_HandleTypeDef*, uint16_t, uint16_t, uint16_t, uint8_t*, uint16_t, uint32_t){return 0;}
+static inline int HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef*, uint16_t, uint16_t, uint16_t, uint8_t*, uint16_t){return 0;}
+static inline void HAL_Delay(uint32_t){}
+static inline uint32_t HAL_GetTick(void){return 0;}
@@ -0,0 +1,1293 @@
+/**
+  ******************************************************************************
+  * @brief   SSD1306 asset compiler (host tool)
+  *  Converts fonts and images into the library formats and prints C++ source with "constexpr" arrays
+
+                        ##### How to build #####
+  ==============================================================================
+
+  The tool is built by the host compiler from the library directory (it uses the font packer of ssd1306_fonts.hpp):
+
+    g++ -std=c++14 -O2 -I. tools/ssd1306_assetc.cpp -o ssd1306_assetc
+
+                        ##### How to use #####
+  ==============================================================================
+
+  Fonts (BDF or PCF, Unicode encoded):
+
+    ssd1306_assetc font <file.bdf|file.pcf> --name NAME [--interval N] [--chars TEXT] [--chars-file FILE] [--pack] [-o FILE]
+
+    - latin symbols 32 .. 126 and cyrillic U+0410 .. U+044F are written as "*_en" and "*_ru" arrays (matrixFont layout),
+      other symbols of the subset (up to 64) - as sparse extra symbols table;
+    - "--chars" / "--chars-file" (UTF-8 text, e.g. all UI strings) select the glyph subset: symbols which are not used
+      are left empty (zero width), "?" and space are always kept;
+    - "--pack" emits the font packed at compile time (SSD1306_FONT_FORMAT::PACKED).
+
+  Images (PBM or PGM, P1 / P2 / P4 / P5):
+
+    ssd1306_assetc image <file.pbm|file.pgm> --name NAME [--format pages|rows] [--dither none|fs|ordered] [--threshold N] [--invert] [-o FILE]
+
+    - dark pixels are turned on ("--invert" to turn on light ones);
+    - gray images are converted by threshold (def = 128), Floyd-Steinberg ("fs") or ordered 8x8 Bayer dithering;
+    - "pages" (def) - ssd1306 GRAM format (BITMAP_FORMAT::PAGE_MAJOR), "rows" - BITMAP_FORMAT::ROW_MAJOR.
+
+  Asset pack (external storage, see ssd1306_assets.hpp):
+
+    ssd1306_assetc pack <manifest> --bin FILE [-o FILE]
+
+    - manifest line: "font NAME file.bdf [interval=N] [chars=FILE]", "image NAME file.pgm [dither=fs] [threshold=N] [invert]"
+      or "strings NAME file.txt" (one UTF-8 string per line), "#" starts a comment;
+    - the pack is written to "--bin" file, "#define ASSET_<NAME> id" lines - to the output.
+
+  Size of every emitted array is written to the output and to stderr.
+
+  Self check (image readers):
+
+    ssd1306_assetc check
+
+    - the same gray image written as P2 (ASCII) and P5 (binary) PGM, and a bitmap as P1 and P4 PBM, must be read back
+      with the original levels.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "ssd1306_fonts.hpp"
+#include "ssd1306_assets_format.hpp"
+
+
+#define MAX_FONT_HEIGHT     32
+#define MAX_FONT_WIDTH      PACKED_GLYPH_WIDTH_MASK
+#define MAX_IMAGE_SIZE      255
+
+#define LATIN_FIRST         32
+#define LATIN_LAST          126
+#define CYRILLIC_FIRST_CP   0x0410
+#define CYRILLIC_LAST_CP    0x044F
+
+
+struct SrcGlyph                                     // glyph of the source font in font cell coordinates
+{
+  int width;                                        // symbol width (px)
+  std::vector<uint32_t> cols;                       // columns, bit 0 is the upper row of the cell
+};
+
+
+struct SrcFont
+{
+  int height;                                       // cell height (ascent + descent)
+  std::map<uint32_t, SrcGlyph> glyphs;              // by Unicode code point
+};
+
+
+struct FontSubset                                   // symbols of the converted font
+{
+  int height;
+  int w;                                            // max symbol width
+  bool has_ru;                                      // cyrillic part is not empty
+  std::vector<SrcGlyph> en, ru, extra;
+  std::vector<uint32_t> en_cps, ru_cps, extra_cps;
+
+  FontSubset() : height(0), w(1), has_ru(false){}
+};
+
+
+struct Options
+{
+  std::string mode;
+  std::string input;
+  std::string output;
+  std::string pack_file;
+  std::string name;
+  std::string chars;
+  bool chars_set;
+  bool pack;
+  int interval;
+  bool page_major;
+  std::string dither;
+  int threshold;
+  bool invert;
+
+  Options() : chars_set(false), pack(false), interval(1), page_major(true), dither("none"), threshold(128), invert(false){}
+};
+
+
+
+
+/**
+ * @brief Prints error and exits
+ */
+static void fail(const char* msg, const char* arg = "")
+{
+  fprintf(stderr, "ssd1306_assetc: %s%s\n", msg, arg);
+  exit(1);
+}
+
+
+
+
+/**
+ * @brief Reads the whole file
+ */
+static std::vector<uint8_t> read_file(const std::string& path)
+{
+  std::vector<uint8_t> buf;
+  FILE* f = fopen(path.c_str(), "rb");
+  uint8_t chunk[4096];
+  size_t n;
+
+  if(!f)
+    fail("can not open ", path.c_str());
+
+  while((n = fread(chunk, 1, sizeof(chunk), f)) > 0)
+    buf.insert(buf.end(), chunk, chunk + n);
+
+  fclose(f);
+  return buf;
+}
+
+
+
+
+/**
+ * @brief Decodes UTF-8 text into code points (invalid bytes are skipped)
+ */
+static std::set<uint32_t> decode_utf8(const std::string& text)
+{
+  std::set<uint32_t> cps;
+  const uint8_t* s = (const uint8_t*)text.c_str();
+  uint32_t cp;
+  int len;
+
+  while(*s)
+  {
+    if(*s < 0x80)       { cp = *s; len = 1; }
+    else if(*s >= 0xF0) { cp = *s & 0x07; len = 4; }
+    else if(*s >= 0xE0) { cp = *s & 0x0F; len = 3; }
+    else if(*s >= 0xC0) { cp = *s & 0x1F; len = 2; }
+    else                { s++; continue; }
+
+    int i = 1;
+    for(; i < len && (s[i] & 0xC0) == 0x80; i++)
+      cp = (cp << 6) | (s[i] & 0x3F);
+
+    if(i == len && cp >= 0x20)
+      cps.insert(cp);
+    s += i;
+  }
+
+  return cps;
+}
+
+
+
+
+/**
+ * @brief Puts glyph bitmap (rows, MSB first) into the font cell. Symbol width is the ink width, empty glyphs take their advance
+ *
+ * @param rows                        glyph rows, "bytes_per_row" bytes each, MSB is the left pixel
+ * @param w, h                        glyph bitmap size
+ * @param x_off                       left bearing
+ * @param top                         row of the cell where the bitmap starts
+ * @param advance                     advance width
+ * @param cell_h                      cell height
+ */
+static SrcGlyph make_glyph(const std::vector<uint8_t>& rows, int bytes_per_row, int w, int h, int x_off, int top, int advance, int cell_h)
+{
+  SrcGlyph g;
+  int right = 0;
+
+  // truncated or overlong bitmap: rows don't match the declared glyph size
+  if(w < 0 || h < 0 || rows.size() != (size_t)bytes_per_row * h)
+    fail("glyph bitmap doesn't match its size");
+
+  if(x_off < 0)
+    x_off = 0;
+
+  g.cols.assign(MAX_FONT_WIDTH, 0);
+
+  for(int y = 0; y < h; y++)
+    for(int x = 0; x < w; x++)
+    {
+      if(!((rows[y*bytes_per_row + x/8] >> (7 - x%8)) & 1))
+        continue;
+
+      int cx = x_off + x, cy = top + y;
+      if(cx >= MAX_FONT_WIDTH || cy < 0 || cy >= cell_h)
+        continue;
+
+      g.cols[cx] |= (uint32_t)1 << cy;
+      right = std::max(right, cx + 1);
+    }
+
+  g.width = right ? right : std::min(std::max(advance - 1, 1), MAX_FONT_WIDTH);
+  g.cols.resize(g.width);
+  return g;
+}
+
+
+
+
+/**
+ * @brief Parses BDF font
+ */
+static SrcFont load_bdf(const std::vector<uint8_t>& file)
+{
+  SrcFont font;
+  std::string text(file.begin(), file.end());
+  size_t pos = 0;
+  int ascent = 0, descent = 0;
+  int bbx_w = 0, bbx_h = 0, bbx_x = 0, bbx_y = 0, advance = 0;
+  long encoding = -1;
+  bool in_bitmap = false;
+  std::vector<uint8_t> rows;
+
+  font.height = 0;
+
+  while(pos < text.size())
+  {
+    size_t end = text.find('\n', pos);
+    if(end == std::string::npos)
+      end = text.size();
+    std::string line = text.substr(pos, end - pos);
+    pos = end + 1;
+
+    if(!line.empty() && line.back() == '\r')
+      line.pop_back();
+
+    char key[32] = {0};
+    sscanf(line.c_str(), "%31s", key);
+
+    if(in_bitmap)
+    {
+      if(!strcmp(key, "ENDCHAR"))
+      {
+        in_bitmap = false;
+        if(encoding >= 0)
+          font.glyphs[(uint32_t)encoding] = make_glyph(rows, (bbx_w + 7)/8, bbx_w, bbx_h, bbx_x, ascent - (bbx_y + bbx_h), advance, font.height);
+        continue;
+      }
+
+      // row: hex digits, "bytes_per_row" bytes
+      for(int i = 0; i < (bbx_w + 7)/8; i++)
+      {
+        unsigned v = 0;
+        if(line.size() < (size_t)(2*i + 2) || sscanf(line.c_str() + 2*i, "%2x", &v) != 1)
+          fail("broken BDF bitmap row: ", line.c_str());
+        rows.push_back((uint8_t)v);
+      }
+    }
+    else if(!strcmp(key, "FONT_ASCENT"))
+      sscanf(line.c_str(), "%*s %d", &ascent);
+    else if(!strcmp(key, "FONT_DESCENT"))
+      sscanf(line.c_str(), "%*s %d", &descent);
+    else if(!strcmp(key, "FONTBOUNDINGBOX") && ascent == 0)
+    {
+      int fw, fh, fx, fy;
+      if(sscanf(line.c_str(), "%*s %d %d %d %d", &fw, &fh, &fx, &fy) == 4)
+      {
+        ascent = fh + fy;
+        descent = -fy;
+      }
+    }
+    else if(!strcmp(key, "STARTCHAR"))
+    {
+      encoding = -1;
+      advance = 0;
+      font.height = ascent + descent;
+    }
+    else if(!strcmp(key, "ENCODING"))
+      sscanf(line.c_str(), "%*s %ld", &encoding);
+    else if(!strcmp(key, "DWIDTH"))
+      sscanf(line.c_str(), "%*s %d", &advance);
+    else if(!strcmp(key, "BBX"))
+      sscanf(line.c_str(), "%*s %d %d %d %d", &bbx_w, &bbx_h, &bbx_x, &bbx_y);
+    else if(!strcmp(key, "BITMAP"))
+    {
+      in_bitmap = true;
+      rows.clear();
+    }
+  }
+
+  if(font.height == 0)
+    font.height = ascent + descent;
+
+  return font;
+}
+
+
+
+
+// PCF tables and format bits
+#define PCF_METRICS             (1 << 2)
+#define PCF_BITMAPS             (1 << 3)
+#define PCF_BDF_ENCODINGS       (1 << 5)
+#define PCF_BYTE_MASK           (1 << 2)
+#define PCF_BIT_MASK            (1 << 3)
+#define PCF_COMPRESSED_METRICS  0x100
+
+
+struct PcfReader                                    // reads integers of PCF table in its byte order
+{
+  const std::vector<uint8_t>& f;
+  size_t pos;
+  bool msb;
+
+  PcfReader(const std::vector<uint8_t>& file, size_t offset) : f(file), pos(offset), msb(false){}
+
+  uint32_t u32()
+  {
+    if(pos + 4 > f.size())
+      fail("broken PCF file");
+    uint32_t v = msb ? (f[pos] << 24 | f[pos+1] << 16 | f[pos+2] << 8 | f[pos+3]) : (f[pos] | f[pos+1] << 8 | f[pos+2] << 16 | f[pos+3] << 24);
+    pos += 4;
+    return v;
+  }
+
+  int16_t i16()
+  {
+    if(pos + 2 > f.size())
+      fail("broken PCF file");
+    uint16_t v = msb ? (f[pos] << 8 | f[pos+1]) : (f[pos] | f[pos+1] << 8);
+    pos += 2;
+    return (int16_t)v;
+  }
+
+  uint8_t u8()
+  {
+    if(pos + 1 > f.size())
+      fail("broken PCF file");
+    return f[pos++];
+  }
+
+  uint32_t format()                                 // table format is always little endian
+  {
+    msb = false;
+    uint32_t fmt = u32();
+    msb = (fmt & PCF_BYTE_MASK) != 0;
+    return fmt;
+  }
+};
+
+
+struct PcfMetrics
+{
+  int left, right, width, ascent, descent;
+};
+
+
+
+
+/**
+ * @brief Parses PCF font (uncompressed, Unicode encoded - "*-iso10646-1")
+ */
+static SrcFont load_pcf(const std::vector<uint8_t>& file)
+{
+  SrcFont font;
+  PcfReader toc(file, 4);
+  std::map<uint32_t, uint32_t> tables;             // type -> offset
+  std::vector<PcfMetrics> metrics;
+  std::vector<uint32_t> offsets;
+  std::map<uint32_t, uint32_t> encodings;          // code point -> glyph index
+  uint32_t fmt, bitmaps_pos = 0, bitmaps_fmt = 0;
+  int ascent = 0, descent = 0;
+
+  uint32_t n = toc.u32();
+  for(uint32_t i = 0; i < n; i++)
+  {
+    uint32_t type = toc.u32();
+    toc.u32();                                      // format
+    toc.u32();                                      // size
+    tables[type] = toc.u32();
+  }
+
+  if(!tables.count(PCF_METRICS) || !tables.count(PCF_BITMAPS) || !tables.count(PCF_BDF_ENCODINGS))
+    fail("PCF file has no metrics, bitmaps or encodings");
+
+  PcfReader r(file, tables[PCF_METRICS]);
+  fmt = r.format();
+  n = (fmt & PCF_COMPRESSED_METRICS) ? (uint16_t)r.i16() : r.u32();
+  for(uint32_t i = 0; i < n; i++)
+  {
+    PcfMetrics m;
+    if(fmt & PCF_COMPRESSED_METRICS)
+    {
+      m.left = r.u8() - 0x80;  m.right = r.u8() - 0x80;  m.width = r.u8() - 0x80;
+      m.ascent = r.u8() - 0x80;  m.descent = r.u8() - 0x80;
+    }
+    else
+    {
+      m.left = r.i16();  m.right = r.i16();  m.width = r.i16();
+      m.ascent = r.i16();  m.descent = r.i16();  r.i16();
+    }
+    ascent = std::max(ascent, m.ascent);
+    descent = std::max(descent, m.descent);
+    metrics.push_back(m);
+  }
+
+  PcfReader rb(file, tables[PCF_BITMAPS]);
+  bitmaps_fmt = rb.format();
+  n = rb.u32();
+  for(uint32_t i = 0; i < n; i++)
+    offsets.push_back(rb.u32());
+  for(int i = 0; i < 4; i++)
+    rb.u32();
+  bitmaps_pos = rb.pos;
+
+  PcfReader re(file, tables[PCF_BDF_ENCODINGS]);
+  re.format();
+  int min2 = re.i16(), max2 = re.i16(), min1 = re.i16(), max1 = re.i16();
+  re.i16();                                          // default char
+  for(int b1 = min1; b1 <= max1; b1++)
+    for(int b2 = min2; b2 <= max2; b2++)
+    {
+      uint16_t idx = (uint16_t)re.i16();
+      if(idx != 0xFFFF && idx < metrics.size())
+        encodings[(uint32_t)(b1 << 8 | b2)] = idx;
+    }
+
+  font.height = ascent + descent;
+
+  const int pad = 1 << (bitmaps_fmt & 3);                      // row padding (bytes)
+  const int unit = 1 << ((bitmaps_fmt >> 4) & 3);              // scan unit (bytes)
+  const bool msb_bit = (bitmaps_fmt & PCF_BIT_MASK) != 0;
+  const bool msb_byte = (bitmaps_fmt & PCF_BYTE_MASK) != 0;
+
+  for(auto& e : encodings)
+  {
+    const PcfMetrics& m = metrics[e.second];
+    int w = m.right - m.left, h = m.ascent + m.descent;
+    int stride = ((w + 8*pad - 1) / (8*pad)) * pad;
+    std::vector<uint8_t> rows;
+
+    if(e.second >= offsets.size())
+      continue;
+
+    // rows are normalized to MSB first bytes and bits
+    for(int y = 0; y < h; y++)
+      for(int b = 0; b < stride; b++)
+      {
+        int src = b;
+        if(msb_bit != msb_byte)
+          src = (b / unit) * unit + (unit - 1 - b % unit);
+        size_t p = bitmaps_pos + offsets[e.second] + y*stride + src;
+        if(p >= file.size())
+          fail("truncated PCF bitmap");
+        uint8_t v = file[p];
+        if(!msb_bit)
+        {
+          uint8_t rv = 0;
+          for(int k = 0; k < 8; k++)
+            rv |= ((v >> k) & 1) << (7 - k);
+          v = rv;
+        }
+        rows.push_back(v);
+      }
+
+    font.glyphs[e.first] = make_glyph(rows, stride, w, h, m.left, ascent - m.ascent, m.width, font.height);
+  }
+
+  return font;
+}
+
+
+
+
+/**
+ * @brief Returns C type of the font column
+ */
+static const char* column_type(int height)
+{
+  return (height <= 8) ? "unsigned char " : ((height <= 16) ? "uint16_t" : "uint32_t");
+}
+
+
+
+
+/**
+ * @brief Writes symbols as font array in matrixFont layout: [width, column 0, .. column W-1]
+ *
+ * @return                            array size (bytes)
+ */
+static size_t write_font_array(FILE* out, const std::string& name, const std::vector<SrcGlyph>& glyphs, const std::vector<uint32_t>& cps, int w, int h)
+{
+  const int word = (h <= 8) ? 1 : ((h <= 16) ? 2 : 4);
+  const int digits = 2 * word;
+
+  fprintf(out, "constexpr %s %s[%zu * (1 + %d)] =\n{\n", column_type(h), name.c_str(), glyphs.size(), w);
+
+  for(size_t i = 0; i < glyphs.size(); i++)
+  {
+    fprintf(out, "  %2d, /*N*/", glyphs[i].width);
+    for(int c = 0; c < w; c++)
+      fprintf(out, " 0x%0*X%s", digits, (c < glyphs[i].width) ? glyphs[i].cols[c] : 0, (c == w - 1 && i == glyphs.size() - 1) ? "" : ",");
+    fprintf(out, " // Symbol U+%04X\n", cps[i]);
+  }
+
+  fprintf(out, "};\n\n");
+  return glyphs.size() * (1 + w) * word;
+}
+
+
+
+
+/**
+ * @brief Returns packed size of the font array (the same packer as "pack_font" uses)
+ */
+static size_t packed_size(const std::vector<SrcGlyph>& glyphs, int w, int h)
+{
+  const uint8_t word = (h <= 8) ? 1 : ((h <= 16) ? 2 : 4);
+  size_t size = 2 * ((glyphs.size() + PACKED_FONT_INDEX_STEP - 1) / PACKED_FONT_INDEX_STEP);
+  std::vector<uint32_t> symbol(1 + w);
+
+  for(const SrcGlyph& g : glyphs)
+  {
+    std::fill(symbol.begin(), symbol.end(), 0);
+    symbol[0] = g.width;
+    std::copy(g.cols.begin(), g.cols.end(), symbol.begin() + 1);
+    size += pack_glyph(symbol.data(), word, (uint8_t*)0);
+  }
+
+  return size;
+}
+
+
+
+
+/**
+ * @brief Loads the font and selects its symbols: latin, cyrillic and extra ones
+ */
+static FontSubset select_glyphs(const Options& opt)
+{
+  std::vector<uint8_t> file = read_file(opt.input);
+  SrcFont src = (file.size() >= 4 && !memcmp(file.data(), "\1fcp", 4)) ? load_pcf(file) : load_bdf(file);
+  std::set<uint32_t> subset;
+  FontSubset fs;
+  std::vector<SrcGlyph>& en = fs.en;
+  std::vector<SrcGlyph>& ru = fs.ru;
+  std::vector<SrcGlyph>& extra = fs.extra;
+  std::vector<uint32_t>& extra_cps = fs.extra_cps;
+  int& w = fs.w;
+
+  fs.height = src.height;
+
+  if(src.glyphs.empty())
+    fail("no glyphs in ", opt.input.c_str());
+  if(src.height > MAX_FONT_HEIGHT)
+    fail("font is higher than 32 px: ", opt.input.c_str());
+
+  if(opt.chars_set)
+  {
+    subset = decode_utf8(opt.chars);
+    subset.insert(' ');
+    subset.insert('?');
+  }
+
+  auto take = [&](uint32_t cp) -> SrcGlyph
+  {
+    SrcGlyph g;
+    auto it = src.glyphs.find(cp);
+
+    if(it == src.glyphs.end() || (opt.chars_set && !subset.count(cp)))
+    {
+      g.width = 0;                                  // not used: empty symbol
+      return g;
+    }
+    w = std::max(w, it->second.width);
+    return it->second;
+  };
+
+  for(uint32_t cp = LATIN_FIRST; cp <= LATIN_LAST; cp++)
+  {
+    en.push_back(take(cp));
+    fs.en_cps.push_back(cp);
+  }
+
+  for(uint32_t cp = CYRILLIC_FIRST_CP; cp <= CYRILLIC_LAST_CP; cp++)
+  {
+    ru.push_back(take(cp));
+    fs.ru_cps.push_back(cp);
+    fs.has_ru |= (ru.back().width != 0);
+  }
+
+  for(auto& e : src.glyphs)
+  {
+    bool in_main = (e.first >= LATIN_FIRST && e.first <= LATIN_LAST) || (e.first >= CYRILLIC_FIRST_CP && e.first <= CYRILLIC_LAST_CP);
+    if(in_main || e.first > 0xFFFF || (opt.chars_set ? !subset.count(e.first) : e.first < 0xA0))
+      continue;
+    if(extra.size() == FONT_EXTRA_MAX_NUM)
+    {
+      fprintf(stderr, "ssd1306_assetc: more than %d extra symbols, the rest are skipped (use --chars)\n", FONT_EXTRA_MAX_NUM);
+      break;
+    }
+    extra.push_back(take(e.first));
+    extra_cps.push_back(e.first);
+  }
+
+  if(opt.chars_set)
+    for(uint32_t cp : subset)
+      if(!src.glyphs.count(cp))
+        fprintf(stderr, "ssd1306_assetc: no glyph for U+%04X\n", cp);
+
+  return fs;
+}
+
+
+
+
+/**
+ * @brief Converts font
+ */
+static void convert_font(const Options& opt, FILE* out)
+{
+  FontSubset fs = select_glyphs(opt);
+  const std::vector<SrcGlyph>& en = fs.en;
+  const std::vector<SrcGlyph>& ru = fs.ru;
+  const std::vector<SrcGlyph>& extra = fs.extra;
+  const std::vector<uint32_t>& extra_cps = fs.extra_cps;
+  const std::string N = opt.name;
+  std::string UN = N;
+  const int w = fs.w;
+  const bool has_ru = fs.has_ru;
+
+  std::transform(UN.begin(), UN.end(), UN.begin(), ::toupper);
+
+  fprintf(out, "// Generated by ssd1306_assetc from %s\n\n", opt.input.c_str());
+  fprintf(out, "#define %s_CHAR_WIDTH       %d\n", UN.c_str(), w);
+  fprintf(out, "#define %s_CHAR_HEIGHT      %d\n", UN.c_str(), fs.height);
+  fprintf(out, "#define %s_CHAR_INTERVAL    %d\n\n", UN.c_str(), opt.interval);
+
+  size_t en_sz = write_font_array(out, N + "_en", en, fs.en_cps, w, fs.height);
+  size_t ru_sz = has_ru ? write_font_array(out, N + "_ru", ru, fs.ru_cps, w, fs.height) : 0;
+  size_t extra_sz = 0;
+
+  if(!extra.empty())
+  {
+    fprintf(out, "constexpr uint16_t %s_extra_cps[%zu] = {", N.c_str(), extra.size());
+    for(size_t i = 0; i < extra_cps.size(); i++)
+      fprintf(out, "%s0x%04X", i ? ", " : "", extra_cps[i]);
+    fprintf(out, "};\n\n");
+    extra_sz = write_font_array(out, N + "_extra", extra, extra_cps, w, fs.height) + 2 * extra.size();
+  }
+
+  std::string base;
+  size_t total;
+
+  if(opt.pack)
+  {
+    size_t en_packed = packed_size(en, w, fs.height), ru_packed = has_ru ? packed_size(ru, w, fs.height) : 0;
+
+    for(const char* part : {"en", "ru"})
+    {
+      if(!strcmp(part, "ru") && !has_ru)
+        continue;
+      fprintf(out, "constexpr unsigned %s_%s_packed_sz = packed_font_size<%d, %s_CHAR_WIDTH, %s_CHAR_HEIGHT>(%s_%s);\n",
+              N.c_str(), part, strcmp(part, "en") ? 64 : 95, UN.c_str(), UN.c_str(), N.c_str(), part);
+      fprintf(out, "constexpr PackedFont<%s_%s_packed_sz> %s_%s_packed = pack_font<%s_%s_packed_sz, %d, %s_CHAR_WIDTH, %s_CHAR_HEIGHT>(%s_%s);\n\n",
+              N.c_str(), part, N.c_str(), part, N.c_str(), part, strcmp(part, "en") ? 64 : 95, UN.c_str(), UN.c_str(), N.c_str(), part);
+    }
+
+    base = "Font(SSD1306_FONT_FORMAT::PACKED, " + UN + "_CHAR_WIDTH, " + UN + "_CHAR_HEIGHT, " + UN + "_CHAR_INTERVAL, (void*)" + N + "_en_packed.data, " +
+           (has_ru ? "(void*)" + N + "_ru_packed.data" : std::string("(void*)0")) + ")";
+    total = en_packed + ru_packed + extra_sz;
+    fprintf(out, "// Size: latin %zu bytes (raw %zu), cyrillic %zu bytes (raw %zu), extra %zu bytes\n", en_packed, en_sz, ru_packed, ru_sz, extra_sz);
+  }
+  else
+  {
+    base = "Font(" + UN + "_CHAR_WIDTH, " + UN + "_CHAR_HEIGHT, " + UN + "_CHAR_INTERVAL, (void*)" + N + "_en, " +
+           (has_ru ? "(void*)" + N + "_ru" : std::string("(void*)0")) + ")";
+    total = en_sz + ru_sz + extra_sz;
+    fprintf(out, "// Size: latin %zu bytes, cyrillic %zu bytes, extra %zu bytes\n", en_sz, ru_sz, extra_sz);
+  }
+
+  if(extra.empty())
+    fprintf(out, "Font %s = {%s};\n", N.c_str(), base.c_str());
+  else
+    fprintf(out, "Font %s = {%s, \n          %s_extra_cps, (void*)%s_extra, %zu};\n", N.c_str(), base.c_str(), N.c_str(), N.c_str(), extra.size());
+
+  fprintf(stderr, "%s: %d x %d px, %zu extra symbols, %zu bytes\n", N.c_str(), w, fs.height, extra.size(), total);
+}
+
+
+
+
+/**
+ * @brief Parses PBM / PGM image into gray levels 0 (black) .. 255 (white)
+ */
+static std::vector<uint8_t> load_pnm(const std::vector<uint8_t>& file, int* w, int* h)
+{
+  size_t pos = 2;
+  int values[3] = {0, 0, 1};
+  std::vector<uint8_t> gray;
+
+  if(file.size() < 3 || file[0] != 'P' || (file[1] != '1' && file[1] != '2' && file[1] != '4' && file[1] != '5'))
+    fail("unsupported image (PBM or PGM expected)");
+
+  const bool bitmap = (file[1] == '1' || file[1] == '4');
+  const bool binary = (file[1] == '4' || file[1] == '5');
+
+  auto skip_space = [&]()
+  {
+    while(pos < file.size())
+    {
+      if(file[pos] == '#')
+        while(pos < file.size() && file[pos] != '\n')
+          pos++;
+      else if(isspace(file[pos]))
+        pos++;
+      else
+        break;
+    }
+  };
+
+  auto read_int = [&]() -> int
+  {
+    int v = 0;
+    skip_space();
+    if(pos >= file.size() || !isdigit(file[pos]))
+      fail("broken image header");
+    while(pos < file.size() && isdigit(file[pos]))
+      v = v*10 + (file[pos++] - '0');
+    return v;
+  };
+
+  for(int i = 0; i < (bitmap ? 2 : 3); i++)
+    values[i] = read_int();
+
+  *w = values[0];
+  *h = values[1];
+  const int maxval = values[2];
+
+  if(*w <= 0 || *h <= 0 || *w > MAX_IMAGE_SIZE || *h > MAX_IMAGE_SIZE)
+    fail("image must be 1 .. 255 px wide and high");
+  if(maxval <= 0 || maxval > 65535)
+    fail("broken image header");
+
+  if(binary)
+    pos++;                                          // single whitespace after the header
+
+  gray.resize(*w * *h);
+
+  for(int y = 0; y < *h; y++)
+    for(int x = 0; x < *w; x++)
+    {
+      unsigned v;
+
+      if(file[1] == '4')
+      {
+        size_t p = pos + y*((*w + 7)/8) + x/8;
+        v = (p < file.size() && ((file[p] >> (7 - x%8)) & 1)) ? 0 : 255;     // 1 - black
+      }
+      else if(file[1] == '1')
+      {
+        skip_space();
+        v = (pos < file.size() && file[pos++] == '1') ? 0 : 255;
+      }
+      else if(binary)
+      {
+        size_t p = pos + ((size_t)y * *w + x) * (maxval > 255 ? 2 : 1);
+        unsigned raw = (maxval > 255) ? ((p + 1 < file.size()) ? (file[p] << 8 | file[p+1]) : 0) : ((p < file.size()) ? file[p] : 0);
+        v = raw * 255 / maxval;
+      }
+      else
+        v = (unsigned)read_int() * 255 / maxval;
+
+      gray[y * *w + x] = (uint8_t)std::min(v, 255u);
+    }
+
+  return gray;
+}
+
+
+
+
+/**
+ * @brief Converts gray image into pixels (1 - on). Dark pixels are on, unless "invert" is set
+ */
+static std::vector<uint8_t> dither(const std::vector<uint8_t>& gray, int w, int h, const Options& opt)
+{
+  static const uint8_t bayer8[8][8] = {
+    { 0, 32,  8, 40,  2, 34, 10, 42}, {48, 16, 56, 24, 50, 18, 58, 26},
+    {12, 44,  4, 36, 14, 46,  6, 38}, {60, 28, 52, 20, 62, 30, 54, 22},
+    { 3, 35, 11, 43,  1, 33,  9, 41}, {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47,  7, 39, 13, 45,  5, 37}, {63, 31, 55, 23, 61, 29, 53, 21}};
+
+  std::vector<uint8_t> on(w*h);
+  std::vector<int> level(gray.begin(), gray.end());
+
+  if(opt.invert)
+    for(int& v : level)
+      v = 255 - v;
+
+  for(int y = 0; y < h; y++)
+    for(int x = 0; x < w; x++)
+    {
+      int v = level[y*w + x];
+      int lit;
+
+      if(opt.dither == "ordered")
+        lit = v < (bayer8[y % 8][x % 8] * 4 + 2);
+      else
+        lit = v < opt.threshold;
+
+      on[y*w + x] = lit;
+
+      if(opt.dither == "fs")                        // error is spread to the right and to the next row: 7/16, 3/16, 5/16, 1/16
+      {
+        int err = v - (lit ? 0 : 255);
+        if(x + 1 < w)              level[y*w + x + 1] += err * 7 / 16;
+        if(y + 1 < h && x > 0)     level[(y + 1)*w + x - 1] += err * 3 / 16;
+        if(y + 1 < h)              level[(y + 1)*w + x] += err * 5 / 16;
+        if(y + 1 < h && x + 1 < w) level[(y + 1)*w + x + 1] += err / 16;
+      }
+    }
+
+  return on;
+}
+
+
+
+
+/**
+ * @brief Converts pixels into page-major data (ssd1306 GRAM format)
+ */
+static std::vector<uint8_t> to_pages(const std::vector<uint8_t>& on, int w, int h)
+{
+  std::vector<uint8_t> data(((h + 7) / 8) * w, 0);
+
+  for(int y = 0; y < h; y++)
+    for(int x = 0; x < w; x++)
+      if(on[y*w + x])
+        data[(y / 8)*w + x] |= 1 << (y % 8);
+
+  return data;
+}
+
+
+
+
+/**
+ * @brief Converts image
+ */
+static void convert_image(const Options& opt, FILE* out)
+{
+  int w, h;
+  std::vector<uint8_t> gray = load_pnm(read_file(opt.input), &w, &h);
+  std::vector<uint8_t> on = dither(gray, w, h, opt);
+  std::vector<uint8_t> data;
+  std::string UN = opt.name;
+  int line;
+
+  std::transform(UN.begin(), UN.end(), UN.begin(), ::toupper);
+
+  if(opt.page_major)
+  {
+    line = w;
+    data = to_pages(on, w, h);
+  }
+  else
+  {
+    line = (w + 7) / 8;
+    data.assign(line * h, 0);
+    for(int y = 0; y < h; y++)
+      for(int x = 0; x < w; x++)
+        if(on[y*w + x])
+          data[y*line + x/8] |= 0x80 >> (x % 8);
+  }
+
+  fprintf(out, "// Generated by ssd1306_assetc from %s (%s, dither: %s)\n", opt.input.c_str(), opt.page_major ? "page-major" : "row-major", opt.dither.c_str());
+  fprintf(out, "// Size: %zu bytes\n", data.size());
+  fprintf(out, "#define %s_WIDTH  %d\n#define %s_HEIGHT %d\n", UN.c_str(), w, UN.c_str(), h);
+  fprintf(out, "constexpr uint8_t %s_data[%zu] =\n{\n", opt.name.c_str(), data.size());
+
+  // one source line (row or page) per text line, wrapped by 16 bytes
+  for(size_t i = 0; i < data.size(); i++)
+  {
+    bool last_in_line = ((i + 1) % line == 0) || ((i % line) % 16 == 15);
+    fprintf(out, "%s0x%02x%s", (i % line) % 16 ? " " : "", data[i], (i + 1 == data.size()) ? "\n" : (last_in_line ? ",\n" : ","));
+  }
+
+  fprintf(out, "};\n\nBitmap %s = {%s_WIDTH, %s_HEIGHT, %s_data, BITMAP_FORMAT::%s};\n", opt.name.c_str(), UN.c_str(), UN.c_str(), opt.name.c_str(),
+          opt.page_major ? "PAGE_MAJOR" : "ROW_MAJOR");
+
+  fprintf(stderr, "%s: %d x %d px, %zu bytes\n", opt.name.c_str(), w, h, data.size());
+}
+
+
+
+
+/**
+ * @brief Appends little-endian number to the pack
+ */
+static void put_le(std::vector<uint8_t>& buf, uint32_t value, int bytes)
+{
+  for(int i = 0; i < bytes; i++)
+    buf.push_back((uint8_t)(value >> (8*i)));
+}
+
+
+
+
+/**
+ * @brief Writes font asset: header, extra code points and 224 glyphs of codes 32 .. 255 in matrixFont layout
+ */
+static std::vector<uint8_t> pack_font_asset(const Options& opt, std::string* info)
+{
+  FontSubset fs = select_glyphs(opt);
+  const int word = (fs.height <= 8) ? 1 : ((fs.height <= 16) ? 2 : 4);
+  std::vector<uint8_t> blob;
+  SrcGlyph empty;
+
+  empty.width = 0;
+
+  blob.push_back((uint8_t)fs.w);
+  blob.push_back((uint8_t)fs.height);
+  blob.push_back((uint8_t)opt.interval);
+  blob.push_back((uint8_t)fs.extra.size());
+  put_le(blob, 0, 4);
+
+  for(uint32_t cp : fs.extra_cps)
+    put_le(blob, cp, 2);
+
+  for(int code = ASSET_FONT_FIRST_CODE; code < ASSET_FONT_FIRST_CODE + ASSET_FONT_CODES_NUM; code++)
+  {
+    const SrcGlyph* g = &empty;
+
+    if(code <= LATIN_LAST)
+      g = &fs.en[code - LATIN_FIRST];
+    else if(code >= FONT_EXTRA_FIRST_CODE && code < 0xC0 && code - FONT_EXTRA_FIRST_CODE < (int)fs.extra.size())
+      g = &fs.extra[code - FONT_EXTRA_FIRST_CODE];
+    else if(code >= 0xC0)
+      g = &fs.ru[code - 0xC0];
+
+    put_le(blob, g->width, word);
+    for(int c = 0; c < fs.w; c++)
+      put_le(blob, (c < g->width) ? g->cols[c] : 0, word);
+  }
+
+  *info = std::to_string(fs.w) + " x " + std::to_string(fs.height) + " px, " + std::to_string(fs.extra.size()) + " extra symbols, glyph " +
+          std::to_string((1 + fs.w) * word) + " bytes";
+  return blob;
+}
+
+
+
+
+/**
+ * @brief Writes bitmap asset: header and page-major data
+ */
+static std::vector<uint8_t> pack_image_asset(const Options& opt, std::string* info)
+{
+  int w, h;
+  std::vector<uint8_t> gray = load_pnm(read_file(opt.input), &w, &h);
+  std::vector<uint8_t> data = to_pages(dither(gray, w, h, opt), w, h);
+  std::vector<uint8_t> blob;
+
+  blob.push_back((uint8_t)w);
+  blob.push_back((uint8_t)h);
+  put_le(blob, 0, 2);
+  blob.insert(blob.end(), data.begin(), data.end());
+
+  *info = std::to_string(w) + " x " + std::to_string(h) + " px";
+  return blob;
+}
+
+
+
+
+/**
+ * @brief Writes string table asset: every line of the UTF-8 text file is a string
+ */
+static std::vector<uint8_t> pack_strings_asset(const Options& opt, std::string* info)
+{
+  std::vector<uint8_t> text = read_file(opt.input);
+  std::vector<std::string> lines(1);
+  std::vector<uint8_t> blob;
+
+  for(uint8_t c : text)
+  {
+    if(c == '\n')
+      lines.emplace_back();
+    else if(c != '\r')
+      lines.back() += (char)c;
+  }
+
+  if(lines.back().empty())
+    lines.pop_back();
+  if(lines.size() > 0xFFFF)
+    fail("too many strings in ", opt.input.c_str());
+
+  uint32_t str = ASSET_STRINGS_HEADER_SZ + 4 * lines.size();
+
+  put_le(blob, lines.size(), 2);
+  put_le(blob, 0, 2);
+
+  for(const std::string& l : lines)
+  {
+    put_le(blob, str, 4);
+    str += l.size() + 1;
+  }
+
+  for(const std::string& l : lines)
+    blob.insert(blob.end(), l.c_str(), l.c_str() + l.size() + 1);
+
+  *info = std::to_string(lines.size()) + " strings";
+  return blob;
+}
+
+
+
+
+/**
+ * @brief Builds asset pack by manifest. Manifest line: <font|image|strings> NAME FILE [option=value ...], "#" starts a comment.
+ *        Font options: interval=N, chars=FILE; image options: dither=none|fs|ordered, threshold=N, invert.
+ *        Asset ids are numbered by type in the manifest order, "#define ASSET_<NAME> id" lines are written to the output
+ */
+static void build_pack(const Options& opt, FILE* out)
+{
+  struct Asset
+  {
+    int type;
+    int id;
+    std::vector<uint8_t> blob;
+  };
+
+  std::vector<uint8_t> manifest = read_file(opt.input);
+  std::string text(manifest.begin(), manifest.end());
+  std::vector<Asset> assets;
+  std::map<int, int> ids;
+  std::vector<uint8_t> pack;
+  size_t pos = 0;
+
+  if(opt.pack_file.empty())
+    fail("--bin is required");
+
+  fprintf(out, "// Generated by ssd1306_assetc from %s\n\n", opt.input.c_str());
+
+  while(pos < text.size())
+  {
+    size_t end = text.find('\n', pos);
+    std::string line = text.substr(pos, (end == std::string::npos) ? std::string::npos : end - pos);
+    std::vector<std::string> words;
+    std::string word;
+    Options a;
+    std::string info;
+    Asset asset;
+
+    pos = (end == std::string::npos) ? text.size() : end + 1;
+
+    if(line.find('#') != std::string::npos)
+      line.erase(line.find('#'));
+
+    for(char c : line + " ")
+    {
+      if(!isspace((uint8_t)c))
+        word += c;
+      else if(!word.empty())
+      {
+        words.push_back(word);
+        word.clear();
+      }
+    }
+
+    if(words.empty())
+      continue;
+    if(words.size() < 3)
+      fail("broken manifest line: ", line.c_str());
+
+    a.name = words[1];
+    a.input = words[2];
+
+    for(size_t i = 3; i < words.size(); i++)
+    {
+      std::string key = words[i].substr(0, words[i].find('='));
+      std::string value = (words[i].find('=') != std::string::npos) ? words[i].substr(words[i].find('=') + 1) : "";
+
+      if(key == "invert")                   a.invert = true;
+      else if(key == "interval")            a.interval = atoi(value.c_str());
+      else if(key == "threshold")           a.threshold = atoi(value.c_str());
+      else if(key == "dither")
+      {
+        if(value != "none" && value != "fs" && value != "ordered")
+          fail("unknown dithering ", value.c_str());
+        a.dither = value;
+      }
+      else if(key == "chars")
+      {
+        std::vector<uint8_t> chars = read_file(value);
+        a.chars.assign(chars.begin(), chars.end());
+        a.chars_set = true;
+      }
+      else
+        fail("unknown asset option ", words[i].c_str());
+    }
+
+    if(words[0] == "font")                  { asset.type = (int)ASSET_TYPE::FONT;    asset.blob = pack_font_asset(a, &info); }
+    else if(words[0] == "image")            { asset.type = (int)ASSET_TYPE::BITMAP;  asset.blob = pack_image_asset(a, &info); }
+    else if(words[0] == "strings")          { asset.type = (int)ASSET_TYPE::STRINGS; asset.blob = pack_strings_asset(a, &info); }
+    else
+      fail("unknown asset type ", words[0].c_str());
+
+    asset.id = ids[asset.type]++;
+    std::transform(a.name.begin(), a.name.end(), a.name.begin(), ::toupper);
+    fprintf(out, "#define ASSET_%-24s %d       // %s, %s, %zu bytes\n", a.name.c_str(), asset.id, a.input.c_str(), info.c_str(), asset.blob.size());
+    assets.push_back(asset);
+  }
+
+  // index is sorted by (type, id): assets of one type are already in id order
+  std::stable_sort(assets.begin(), assets.end(), [](const Asset& l, const Asset& r){return l.type < r.type;});
+
+  if(assets.size() > 0xFFFF)
+    fail("too many assets");
+
+  put_le(pack, ASSET_PACK_MAGIC, 4);
+  put_le(pack, assets.size(), 2);
+  put_le(pack, 0, 2);
+
+  uint32_t offset = ASSET_PACK_HEADER_SZ + ASSET_ENTRY_SZ * assets.size();
+
+  for(const Asset& asset : assets)
+  {
+    pack.push_back((uint8_t)asset.type);
+    pack.push_back(0);
+    put_le(pack, asset.id, 2);
+    put_le(pack, offset, 4);
+    put_le(pack, asset.blob.size(), 4);
+    offset += asset.blob.size();
+  }
+
+  for(const Asset& asset : assets)
+    pack.insert(pack.end(), asset.blob.begin(), asset.blob.end());
+
+  FILE* bin = fopen(opt.pack_file.c_str(), "wb");
+  if(!bin || fwrite(pack.data(), 1, pack.size(), bin) != pack.size())
+    fail("can not write ", opt.pack_file.c_str());
+  fclose(bin);
+
+  fprintf(out, "\n// Pack size: %zu bytes\n", pack.size());
+  fprintf(stderr, "%s: %zu assets, %zu bytes\n", opt.pack_file.c_str(), assets.size(), pack.size());
+}
+
+
+
+
+/**
+ * @brief Reads back the images written in every supported PNM format and compares them with the source levels
+ */
+static void check_image_readers()
+{
+  static const uint8_t levels[8] = {0, 255, 0, 255, 17, 128, 200, 9};    // 4 x 2 px
+  const std::string p2 = "P2\n# comment\n4 2\n255\n0 255 0 255\n17 128 200 9\n";
+  const std::string p5 = std::string("P5 4 2 255\n") + std::string((const char*)levels, sizeof(levels));
+  const std::string p1 = "P1\n4 2\n1 0 1 0\n0101\n";
+  const std::string p4 = std::string("P4 4 2\n") + "\xA0\x50";
+  const struct { const char* name; const std::string* file; bool bitmap; } images[4] = {
+    {"P2", &p2, false}, {"P5", &p5, false}, {"P1", &p1, true}, {"P4", &p4, true}};
+
+  for(const auto& image : images)
+  {
+    int w = 0, h = 0;
+    std::vector<uint8_t> gray = load_pnm(std::vector<uint8_t>(image.file->begin(), image.file->end()), &w, &h);
+
+    if(w != 4 || h != 2)
+      fail("wrong image size read from ", image.name);
+
+    for(int i = 0; i < w*h; i++)
+      if(gray[i] != (image.bitmap ? ((i + i/4) % 2 ? 255 : 0) : levels[i]))
+        fail("wrong pixels read from ", image.name);
+  }
+
+  fprintf(stderr, "image readers: ok\n");
+}
+
+
+
+
+int main(int argc, char** argv)
+{
+  Options opt;
+
+  if(argc == 2 && !strcmp(argv[1], "check"))
+  {
+    check_image_readers();
+    return 0;
+  }
+
+  if(argc < 3)
+  {
+    fprintf(stderr, "usage: ssd1306_assetc font <file.bdf|file.pcf> --name NAME [--interval N] [--chars TEXT] [--chars-file FILE] [--pack] [-o FILE]\n"
+                    "       ssd1306_assetc image <file.pbm|file.pgm> --name NAME [--format pages|rows] [--dither none|fs|ordered] [--threshold N] [--invert] [-o FILE]\n"
+                    "       ssd1306_assetc pack <manifest> --bin FILE [-o FILE]\n"
+                    "       ssd1306_assetc check\n");
+    return 1;
+  }
+
+  opt.mode = argv[1];
+  opt.input = argv[2];
+
+  for(int i = 3; i < argc; i++)
+  {
+    std::string a = argv[i];
+    const char* v = (i + 1 < argc) ? argv[i + 1] : (const char*)0;
+
+    if(a == "--pack")                      opt.pack = true;
+    else if(a == "--invert")               opt.invert = true;
+    else if(!v)                            fail("missing value of ", a.c_str());
+    else if(a == "--name")                 { opt.name = v; i++; }
+    else if(a == "-o")                     { opt.output = v; i++; }
+    else if(a == "--bin")                  { opt.pack_file = v; i++; }
+    else if(a == "--interval")             { opt.interval = atoi(v); i++; }
+    else if(a == "--threshold")            { opt.threshold = atoi(v); i++; }
+    else if(a == "--dither")               { opt.dither = v; i++; }
+    else if(a == "--format")
+    {
+      if(strcmp(v, "pages") && strcmp(v, "rows"))
+        fail("unknown format ", v);
+      opt.page_major = strcmp(v, "rows") != 0;
+      i++;
+    }
+    else if(a == "--chars")                { opt.chars += v; opt.chars_set = true; i++; }
+    else if(a == "--chars-file")
+    {
+      std::vector<uint8_t> text = read_file(v);
+      opt.chars.append(text.begin(), text.end());
+      opt.chars_set = true;
+      i++;
+    }
+    else
+      fail("unknown option ", a.c_str());
+  }
+
+  if(opt.name.empty() && opt.mode != "pack")
+    fail("--name is required");
+  if(opt.dither != "none" && opt.dither != "fs" && opt.dither != "ordered")
+    fail("unknown dithering ", opt.dither.c_str());
+
+  FILE* out = opt.output.empty() ? stdout : fopen(opt.output.c_str(), "w");
+  if(!out)
+    fail("can not create ", opt.output.c_str());
+
+  if(opt.mode == "font")
+    convert_font(opt, out);
+  else if(opt.mode == "image")
+    convert_image(opt, out);
+  else if(opt.mode == "pack")
+    build_pack(opt, out);
+  else
+    fail("unknown mode ", opt.mode.c_str());
+
+  if(out != stdout)
+    fclose(out);
+
+  return 0;
+}
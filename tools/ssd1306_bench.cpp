@@ -0,0 +1,111 @@
+/**
+  ******************************************************************************
+  * @brief   SSD1306 drawing benchmark (host tool)
+  *  Times drawing of a row-major picture per pixel and by "draw_bitmap" (8x8 bit transpose kernel)
+
+                        ##### How to build #####
+  ==============================================================================
+
+  The tool is built by the host compiler from the library directory together with the library sources.
+  tools/host/stm32_cmsis.h replaces the HAL, transfers to the display are discarded:
+
+    g++ -std=c++14 -O2 -funsigned-char -I. -Itools/host tools/ssd1306_bench.cpp \
+        ssd1306_bitmaps.cpp ssd1306_display.cpp ssd1306_fonts.cpp ssd1306_format.cpp ssd1306_ll_interface.cpp -o ssd1306_bench
+
+                        ##### How to use #####
+  ==============================================================================
+
+    ssd1306_bench [loops]
+
+    - draws the row-major copy of "big_car" (128 x 42) "loops" times (def = 20000) by every path
+      and prints average time of one draw in microseconds;
+    - the pictures drawn by both paths are compared, the benchmark fails if they differ.
+
+  The numbers show the ratio of the paths on the host CPU. On the MCU use "ssd1306_bitmap_bench" (ssd1306_tests.cpp).
+*/
+
+#include "ssd1306.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+
+static I2C_HandleTypeDef hi2c;
+static uint8_t car_rows[(128 / 8) * 42];
+
+
+static void draw_per_pixel(SSD1306_Display* display, Bitmap& car, uint8_t y0)
+{
+  for(uint8_t y = 0; y < car.h; y++)
+    for(uint8_t x = 0; x < car.w; x++)
+      display->draw_pixel(x, y0 + y, (car.data[y * (car.w / 8) + x / 8] >> (7 - x % 8)) & 0x01);
+}
+
+
+static void draw_transpose(SSD1306_Display* display, Bitmap& car, uint8_t y0)
+{
+  display->draw_bitmap(0, y0, car);
+}
+
+
+template<typename F>
+static double time_draws(F draw, SSD1306_Display* display, Bitmap& car, unsigned loops)
+{
+  auto start = std::chrono::steady_clock::now();
+
+  for(unsigned n = 0; n < loops; n++)
+    draw(display, car, ROW3 + (n & 0x01));              // alternating position: page aligned and not aligned
+
+  auto stop = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double, std::micro>(stop - start).count() / loops;
+}
+
+
+int main(int argc, char** argv)
+{
+  unsigned loops = (argc > 1) ? (unsigned)atoi(argv[1]) : 20000;
+  static uint8_t gram_pixel[1024];
+
+  if(loops == 0)
+    loops = 1;
+
+  SSD1306_Display* display = SSD1306_Display::create(SSD1306_SCREEN_RESOLUTION::W128xH64, &hi2c, 0x78);
+
+  // row-major copy of "big_car", which is stored page-major
+  for(unsigned y = 0; y < big_car.h; y++)
+    for(unsigned x = 0; x < big_car.w; x++)
+      if((big_car.data[(y / 8) * big_car.w + x] >> (y % 8)) & 0x01)
+        car_rows[y * (big_car.w / 8) + x / 8] |= 0x80 >> (x % 8);
+
+  Bitmap car(big_car.w, big_car.h, car_rows);
+  BlitSource gram(*display->dds);                       // segment memory of the whole display
+
+  // both paths must draw the same picture
+  for(uint8_t y0 = ROW3; y0 <= ROW3 + 1; y0++)
+  {
+    display->clear_screen();
+    draw_per_pixel(display, car, y0);
+    memcpy(gram_pixel, gram.data, sizeof(gram_pixel));
+
+    display->clear_screen();
+    draw_transpose(display, car, y0);
+
+    if(memcmp(gram_pixel, gram.data, sizeof(gram_pixel)) != 0)
+    {
+      fprintf(stderr, "error: pictures differ at y = %u\n", y0);
+      return 1;
+    }
+  }
+
+  double t_pixel = time_draws(draw_per_pixel, display, car, loops);
+  double t_transpose = time_draws(draw_transpose, display, car, loops);
+
+  printf("row-major 128x42, %u loops\n", loops);
+  printf("per pixel:   %8.2f us/draw\n", t_pixel);
+  printf("transpose:   %8.2f us/draw (x%.1f)\n", t_transpose, t_pixel / t_transpose);
+
+  return 0;
+}